@@ -16,6 +16,10 @@
 #include <xtensor/core/xtensor_forward.hpp>
 #include <xtensor/generators/xrandom.hpp>
 #include <xtensor/io/xio.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/kernels.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
 
 #define RANGE 2 << 8, 2 << 20
 #define MULTIPLIER 16
@@ -80,6 +84,60 @@ void Dot_Acol_Bcol(benchmark::State& state) {
 }
 BENCHMARK(Dot_Acol_Bcol)->RangeMultiplier(MULTIPLIER)->Range(RANGE)->Unit(benchmark::kMillisecond);
 
+// Derivative of a block of elements: Np × K nodal values, one shared Np × Np operator.
+#define ELEMENT_RANGE 2 << 4, 2 << 14
+constexpr auto BLOCK_TYPE = oiseau::dg::nodal::RefElementType::Hexahedron;
+constexpr unsigned BLOCK_ORDER = 3;
+
+// Benchmark: one xt::linalg::dot per element
+void Block_Dot_PerElement(benchmark::State& state) {
+  using namespace xt;
+  const auto ref = oiseau::dg::nodal::get_ref_element(BLOCK_TYPE, BLOCK_ORDER);
+  const xtensor<double, 2> d = view(ref->d(), all(), all(), 0);
+  const std::size_t np = ref->number_of_nodes();
+  const auto n_elements = static_cast<std::size_t>(state.range(0));
+  xtensor<double, 2> u = random::rand<double>({n_elements, np});
+
+  for (auto _ : state) {
+    for (std::size_t e = 0; e < n_elements; ++e) {
+      xtensor<double, 1> res = xt::linalg::dot(d, view(u, e, all()));
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Block_Dot_PerElement)
+    ->RangeMultiplier(MULTIPLIER)
+    ->Range(ELEMENT_RANGE)
+    ->Unit(benchmark::kMillisecond);
+
+// Benchmark: the whole block as one batched product
+void Block_Batched(benchmark::State& state, oiseau::dg::nodal::GemmBackend backend) {
+  if (backend == oiseau::dg::nodal::GemmBackend::Blas && !oiseau::dg::nodal::has_blas_backend()) {
+    state.SkipWithError("built without a BLAS backend");
+    return;
+  }
+  const oiseau::dg::nodal::BlockOperators ops(BLOCK_TYPE, BLOCK_ORDER, backend);
+  const std::size_t np = ops.reference().number_of_nodes();
+  const auto n_elements = static_cast<std::size_t>(state.range(0));
+  xt::xtensor<double, 2> u = xt::random::rand<double>({n_elements, np});
+  std::vector<double> out(n_elements * np);
+
+  for (auto _ : state) {
+    ops.d(0, {u.data(), u.size()}, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(Block_Batched, kernels, oiseau::dg::nodal::GemmBackend::Kernels)
+    ->RangeMultiplier(MULTIPLIER)
+    ->Range(ELEMENT_RANGE)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Block_Batched, blas, oiseau::dg::nodal::GemmBackend::Blas)
+    ->RangeMultiplier(MULTIPLIER)
+    ->Range(ELEMENT_RANGE)
+    ->Unit(benchmark::kMillisecond);
+
 int main(int argc, char** argv) {
   omp_set_num_threads(8);  // Set the number of threads to 8
   benchmark::MaybeReenterWithoutASLR(argc, argv);
@@ -0,0 +1,233 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Throughput of the mesh I/O paths on synthetic triangle meshes of 10k to 50M cells, in ASCII
+// and binary MSH 4.1. Each benchmark reports MB/s of file data and cells/s, or nodes/s for the
+// `$Nodes` parse, as the `MB` and `cells` or `nodes` rate counters. Reads run against a warm page
+// cache; the input files are generated on first use and removed at exit.
+// Use --benchmark_filter to restrict the sizes, e.g. --benchmark_filter='cells:10000/'.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oiseau/io/gmsh.hpp"
+#include "oiseau/io/gmsh_file.hpp"
+#include "oiseau/io/gmsh_index.hpp"
+#include "oiseau/io/xdmf.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
+namespace {
+
+/// A structured `nx` by `ny` grid of unit squares, each split into two triangles.
+oiseau::mesh::Mesh make_triangle_grid(std::size_t cells) {
+  const auto nx = static_cast<std::size_t>(std::ceil(std::sqrt(cells / 2.0)));
+  const std::size_t ny = (cells / 2 + nx - 1) / nx;
+  std::vector<double> x;
+  x.reserve(3 * (nx + 1) * (ny + 1));
+  for (std::size_t j = 0; j <= ny; ++j) {
+    for (std::size_t i = 0; i <= nx; ++i) x.insert(x.end(), {double(i), double(j), 0.0});
+  }
+  std::vector<std::size_t> data;
+  data.reserve(6 * nx * ny);
+  for (std::size_t j = 0; j < ny; ++j) {
+    for (std::size_t i = 0; i < nx; ++i) {
+      const std::size_t v = j * (nx + 1) + i;
+      data.insert(data.end(), {v, v + 1, v + nx + 2, v, v + nx + 2, v + nx + 1});
+    }
+  }
+  const std::size_t n_cells = data.size() / 3;
+  std::vector<std::size_t> offsets(n_cells + 1);
+  for (std::size_t c = 0; c <= n_cells; ++c) offsets[c] = 3 * c;
+  std::vector<oiseau::mesh::CellType> cell_types(
+      n_cells, oiseau::mesh::get_cell_type(oiseau::mesh::CellKind::Triangle));
+  return {oiseau::mesh::Topology(
+              oiseau::utils::JaggedArray<std::size_t>(std::move(data), std::move(offsets)),
+              std::move(cell_types)),
+          oiseau::mesh::Geometry(std::move(x), 3)};
+}
+
+std::filesystem::path temp_file(const std::string& name) {
+  return std::filesystem::temp_directory_path() / ("oiseau_benchmark_" + name);
+}
+
+/// Synthetic input files, written once per size and encoding and removed at exit.
+class InputFiles {
+ public:
+  ~InputFiles() {
+    std::error_code ignored;
+    for (const auto& [key, path] : m_paths) std::filesystem::remove(path, ignored);
+  }
+
+  const std::filesystem::path& get(std::size_t cells, bool binary) {
+    auto [it, inserted] = m_paths.try_emplace({cells, binary});
+    if (inserted) {
+      it->second = temp_file(std::to_string(cells) + (binary ? "_binary.msh" : "_ascii.msh"));
+      oiseau::io::gmsh_write(it->second, make_triangle_grid(cells), {.binary = binary});
+    }
+    return it->second;
+  }
+
+ private:
+  std::map<std::pair<std::size_t, bool>, std::filesystem::path> m_paths;
+};
+
+InputFiles& input_files() {
+  static InputFiles files;
+  return files;
+}
+
+std::string read_file(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+/**
+ * Reports the rates of `bytes` of file data and of `items`, counted in `unit`; rate counters are
+ * printed per second, e.g. `MB=212/s cells=18M/s`. `file_MB` is the size of the data itself.
+ */
+void report(benchmark::State& state, std::size_t bytes, std::size_t items,
+            const std::string& unit = "cells") {
+  using benchmark::Counter;
+  const double mb = static_cast<double>(bytes) / 1e6;
+  state.counters["MB"] = Counter(mb, Counter::kIsIterationInvariantRate);
+  state.counters[unit] = Counter(static_cast<double>(items), Counter::kIsIterationInvariantRate);
+  state.counters["file_MB"] = mb;
+}
+
+std::size_t n_cells(const benchmark::State& state) {
+  return static_cast<std::size_t>(state.range(0));
+}
+
+bool is_binary(const benchmark::State& state) { return state.range(1) != 0; }
+
+void gmsh_read_from_path(benchmark::State& state) {
+  const auto& path = input_files().get(n_cells(state), is_binary(state));
+  std::size_t cells = 0;
+  for (auto _ : state) {
+    oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_path(path);
+    cells = mesh.topology().n_cells();
+    benchmark::DoNotOptimize(mesh);
+  }
+  report(state, std::filesystem::file_size(path), cells);
+}
+
+void gmsh_read_from_string(benchmark::State& state) {
+  const std::string content = read_file(input_files().get(n_cells(state), is_binary(state)));
+  std::size_t cells = 0;
+  for (auto _ : state) {
+    oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(content);
+    cells = mesh.topology().n_cells();
+    benchmark::DoNotOptimize(mesh);
+  }
+  report(state, content.size(), cells);
+}
+
+void gmsh_file_read(benchmark::State& state) {
+  const std::string content = read_file(input_files().get(n_cells(state), is_binary(state)));
+  std::size_t cells = 0;
+  for (auto _ : state) {
+    const oiseau::io::GMSHFile file{std::string_view(content)};
+    cells = file.elements_section.num_elements;
+    benchmark::DoNotOptimize(file);
+  }
+  report(state, content.size(), cells);
+}
+
+void gmsh_index_file(benchmark::State& state) {
+  const std::string content = read_file(input_files().get(n_cells(state), is_binary(state)));
+  for (auto _ : state) {
+    auto index = oiseau::io::detail::index_file(content);
+    benchmark::DoNotOptimize(index);
+  }
+  report(state, content.size(), n_cells(state));
+}
+
+/// Parses the indexed `$Nodes` (`nodes == true`) or `$Elements` section on its own.
+void gmsh_parse_section(benchmark::State& state, bool nodes) {
+  using namespace oiseau::io::detail;
+  const std::string content = read_file(input_files().get(n_cells(state), is_binary(state)));
+  const FileIndex index = index_file(content);
+  const SectionIndex* section = index.find(nodes ? "Nodes" : "Elements");
+  const bool binary = index.format.is_binary;
+  for (auto _ : state) {
+    if (nodes) {
+      auto parsed = parse_nodes(content, *section, binary);
+      benchmark::DoNotOptimize(parsed);
+    } else {
+      auto parsed = parse_elements(content, *section, binary);
+      benchmark::DoNotOptimize(parsed);
+    }
+  }
+  // The section header holds the number of nodes or of elements.
+  report(state, section->end - section->begin, section->header[1], nodes ? "nodes" : "cells");
+}
+
+void gmsh_parse_nodes(benchmark::State& state) { gmsh_parse_section(state, true); }
+void gmsh_parse_elements(benchmark::State& state) { gmsh_parse_section(state, false); }
+
+void gmsh_write(benchmark::State& state) {
+  const oiseau::mesh::Mesh mesh = make_triangle_grid(n_cells(state));
+  const auto path = temp_file("write.msh");
+  for (auto _ : state) oiseau::io::gmsh_write(path, mesh, {.binary = is_binary(state)});
+  report(state, std::filesystem::file_size(path), mesh.topology().n_cells());
+  std::filesystem::remove(path);
+}
+
+void xdmf_write_mesh(benchmark::State& state) {
+  const oiseau::mesh::Mesh mesh = make_triangle_grid(n_cells(state));
+  const auto path = temp_file("write.xdmf");
+  const auto data = std::filesystem::path(path).replace_extension(".bin");
+  for (auto _ : state) {
+    oiseau::io::XDMFWriter writer(path, mesh);
+    benchmark::DoNotOptimize(writer);
+  }
+  report(state, std::filesystem::file_size(data), mesh.topology().n_cells());
+  std::filesystem::remove(path);
+  std::filesystem::remove(data);
+}
+
+/// Every size for the binary and the ASCII encoding.
+void io_sizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"cells", "binary"})
+      ->ArgsProduct({{10'000, 100'000, 1'000'000, 10'000'000, 50'000'000}, {0, 1}})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK(gmsh_read_from_path)->Apply(io_sizes);
+BENCHMARK(gmsh_read_from_string)->Apply(io_sizes);
+BENCHMARK(gmsh_file_read)->Apply(io_sizes);
+BENCHMARK(gmsh_index_file)->Apply(io_sizes);
+BENCHMARK(gmsh_parse_nodes)->Apply(io_sizes);
+BENCHMARK(gmsh_parse_elements)->Apply(io_sizes);
+BENCHMARK(gmsh_write)->Apply(io_sizes);
+// The heavy data of XDMF is always binary.
+BENCHMARK(xdmf_write_mesh)
+    ->ArgNames({"cells"})
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->Arg(1'000'000)
+    ->Arg(10'000'000)
+    ->Arg(50'000'000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -1,20 +0,0 @@
-// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
-//
-// This file is part of oiseau (https://github.com/tiagovla/oiseau)
-//
-// SPDX-License-Identifier: GPL-3.0-or-later
-
-#include <benchmark/benchmark.h>
-
-static void BM_SomeFunction(benchmark::State& state) {
-  // Perform setup here
-  volatile int i = 0;
-  for (auto _ : state) {
-    // This code gets timed
-    i = i + 1;
-  }
-}
-// Register the function as a benchmark
-BENCHMARK(BM_SomeFunction);
-// Run the benchmark
-BENCHMARK_MAIN();
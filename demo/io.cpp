@@ -40,7 +40,7 @@ void three_dimensional() {
   auto& topology = mesh.topology();
 
   auto cell_types = topology.cell_types();
-  auto conn = topology.conn();
+  const auto& conn = topology.conn();
 
   for (auto [ct, vertices] : std::views::zip(cell_types, conn)) {
     std::cout << ct->name() << std::endl;
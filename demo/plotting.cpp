@@ -36,11 +36,11 @@ int main() {
   auto y_coord = xt::col(coords, 1);
   auto z_coord = xt::col(coords, 2);
 
-  auto conn = mesh.topology().conn();
+  const auto &conn = mesh.topology().conn();
   auto cells = mesh.topology().cell_types();
 
   std::vector<double> flat;
-  for (std::size_t i = 0; i < conn.size(); i++) {
+  for (std::size_t i = 0; i < conn.num_rows(); i++) {
     if (cells[i]->kind() == CellKind::Triangle) {
       flat.insert(flat.end(), conn[i].begin(), conn[i].end());
     }
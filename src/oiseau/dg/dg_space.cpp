@@ -8,8 +8,11 @@
 
 #include <array>
 #include <cstddef>
+#include <map>
 #include <span>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <xtensor-blas/xlinalg.hpp>
 #include <xtensor/containers/xadapt.hpp>
@@ -21,50 +24,111 @@
 #include "oiseau/dg/nodal/element.hpp"
 #include "oiseau/dg/nodal/ref_element.hpp"
 #include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
 #include "oiseau/mesh/mesh.hpp"
 
 namespace oiseau::dg {
 
+namespace {
+
+nodal::RefElementType ref_element_type(mesh::CellKind kind) {
+  switch (kind) {
+  case mesh::CellKind::Triangle:
+    return nodal::RefElementType::Triangle;
+  case mesh::CellKind::Quadrilateral:
+    return nodal::RefElementType::Quadrilateral;
+  case mesh::CellKind::Tetrahedron:
+    return nodal::RefElementType::Tetrahedron;
+  case mesh::CellKind::Hexahedron:
+    return nodal::RefElementType::Hexahedron;
+  case mesh::CellKind::Prism:
+    return nodal::RefElementType::Prism;
+  case mesh::CellKind::Pyramid:
+    return nodal::RefElementType::Pyramid;
+  default:
+    throw std::runtime_error("Unsupported cell type");
+  }
+}
+
+}  // namespace
+
 DGSpace::DGSpace(const mesh::Mesh& mesh, const std::vector<unsigned>& orders)
     : m_mesh(mesh), m_orders(orders) {
   m_elements.reserve(orders.size());
 
-  auto topology = mesh.topology();
-  auto geometry = mesh.geometry();
+  const auto& topology = mesh.topology();
+  const auto& geometry = mesh.geometry();
+  const auto& high_order_nodes = geometry.high_order_nodes();
   auto cell_types = topology.cell_types();
+  const auto x = geometry.x();
 
-  std::array<std::size_t, 2> shape = {geometry.x().size() / geometry.dim(), geometry.dim()};
-  auto nodes = xt::adapt(geometry.x().data(), geometry.x().size(), xt::no_ownership(), shape);
+  std::array<std::size_t, 2> shape = {x.size() / geometry.dim(), geometry.dim()};
+  auto nodes = xt::adapt(x.data(), x.size(), xt::no_ownership(), shape);
+
+  // Maps the nodes of an order-q geometry (in gmsh order) to the nodes of an order-p element:
+  // V_q(r_p) * V_q(r_gmsh)^-1, shared by all cells with the same (type, q, p).
+  std::map<std::tuple<nodal::RefElementType, unsigned, unsigned>, xt::xarray<double>> interp_cache;
 
   for (std::size_t i = 0; i < cell_types.size(); ++i) {
     const auto& cell_type = cell_types[i];
     mesh::CellKind kind = cell_type->kind();
 
-    nodal::RefElementType ref_type;
-    switch (kind) {
-    case mesh::CellKind::Triangle:
-      ref_type = nodal::RefElementType::Triangle;
-      break;
-    case mesh::CellKind::Quadrilateral:
-      ref_type = nodal::RefElementType::Quadrilateral;
-      // FIX: wrong quadrilateral ordering
-      break;
-    default:
-      throw std::runtime_error("Unsupported cell type");
+    const nodal::RefElementType ref_type = ref_element_type(kind);
+
+    auto cell_conn = topology.conn()[i];
+    std::vector<std::size_t> cell_nodes(cell_conn.begin(), cell_conn.end());
+    if (high_order_nodes.num_rows() > 0) {
+      auto extra = high_order_nodes[i];
+      cell_nodes.insert(cell_nodes.end(), extra.begin(), extra.end());
     }
+    const unsigned geometry_order = mesh::geometry_order(kind, cell_nodes.size());
 
-    auto interp_elem = nodal::get_ref_element(ref_type, 1);
     auto ref_elem = nodal::get_ref_element(ref_type, orders[i]);
-    auto x_view = xt::view(nodes, xt::keep(topology.conn()[i]), xt::all());
+    auto [it, inserted] = interp_cache.try_emplace({ref_type, geometry_order, orders[i]});
+    if (inserted) {
+      auto geometry_elem = nodal::get_ref_element(ref_type, geometry_order);
+      const std::size_t tdim = cell_type->dimension();
+      std::vector<double> r_geometry = mesh::reference_nodes(kind, geometry_order);
+      std::array<std::size_t, 2> r_shape = {r_geometry.size() / tdim, tdim};
+      xt::xarray<double> r = xt::adapt(r_geometry, r_shape);
+      auto inv_v = xt::linalg::inv(geometry_elem->vandermonde(r));
+      it->second = xt::linalg::dot(geometry_elem->vandermonde(ref_elem->r()), inv_v);
+    }
 
-    auto inv_v = xt::linalg::inv(interp_elem->v());
-    auto v = interp_elem->vandermonde(ref_elem->r());
-    auto interp_x = xt::linalg::dot(xt::linalg::dot(v, inv_v), x_view);
+    auto x_view = xt::view(nodes, xt::keep(cell_nodes), xt::all());
+    auto interp_x = xt::linalg::dot(it->second, x_view);
 
     m_elements.emplace_back(ref_elem, interp_x);
   }
   // TODO(tiagovla): clean up this mess, introduce proper api
 }
+
+DGSpace::DGSpace(const mesh::Mesh& mesh, const std::vector<unsigned>& orders,
+                 std::span<const double> element_nodes, std::size_t gdim)
+    : m_mesh(mesh), m_orders(orders) {
+  auto cell_types = mesh.topology().cell_types();
+  if (orders.size() != cell_types.size()) {
+    throw std::invalid_argument("DGSpace: expected one order per cell");
+  }
+  m_elements.reserve(orders.size());
+  std::size_t offset = 0;
+  for (std::size_t i = 0; i < cell_types.size(); ++i) {
+    auto ref_elem = nodal::get_ref_element(ref_element_type(cell_types[i]->kind()), orders[i]);
+    const std::size_t size = ref_elem->number_of_nodes() * gdim;
+    if (offset + size > element_nodes.size()) {
+      throw std::invalid_argument("DGSpace: too few element nodes for the given orders");
+    }
+    std::array<std::size_t, 2> shape = {ref_elem->number_of_nodes(), gdim};
+    xt::xarray<double> nodes = xt::adapt(element_nodes.data() + offset, size, xt::no_ownership(),
+                                         shape);
+    m_elements.emplace_back(ref_elem, std::move(nodes));
+    offset += size;
+  }
+  if (offset != element_nodes.size()) {
+    throw std::invalid_argument("DGSpace: too many element nodes for the given orders");
+  }
+}
+
 std::span<const nodal::Element> DGSpace::elements() const { return {m_elements}; }
 std::span<const unsigned> DGSpace::orders() const { return {m_orders}; }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iostream>
 #include <span>
 #include <vector>
@@ -19,6 +20,14 @@ class DGSpace {
  public:
   DGSpace(const DGSpace& V) = delete;
   DGSpace(const mesh::Mesh& mesh, const std::vector<unsigned>& orders);
+  /**
+   * @brief Adopts precomputed element nodes instead of interpolating the mesh geometry.
+   *
+   * Used on restart from a checkpoint: `element_nodes` lists the nodes of every element in
+   * turn, `gdim` coordinates each, as returned by `elements()[i].nodes()`.
+   */
+  DGSpace(const mesh::Mesh& mesh, const std::vector<unsigned>& orders,
+          std::span<const double> element_nodes, std::size_t gdim);
   DGSpace(DGSpace&& V) = default;
   virtual ~DGSpace() = default;
   DGSpace& operator=(const DGSpace& V) = delete;
@@ -0,0 +1,164 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nodal/kernels.hpp"
+
+#ifdef WITH_OPENBLAS
+#include <cblas.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/utils/aligned_matrix.hpp"
+#include "oiseau/utils/thread_pool.hpp"
+
+namespace oiseau::dg::nodal {
+
+bool has_blas_backend() {
+#ifdef WITH_OPENBLAS
+  return true;
+#else
+  return false;
+#endif
+}
+
+namespace detail {
+
+void apply_dynamic(const utils::AlignedMatrix& a, const double* x, double* y,
+                   std::size_t n_elements) {
+  std::vector<lane_vector, utils::AlignedAllocator<lane_vector>> xs(a.cols());
+  std::vector<lane_vector, utils::AlignedAllocator<lane_vector>> ys(a.rows());
+  apply_blocked(a.data(), a.stride(), a.rows(), a.cols(), x, y, n_elements, xs.data(),
+                ys.data());
+}
+
+}  // namespace detail
+
+namespace {
+
+template <RefElementType Type, unsigned Order>
+ElementKernels fixed_kernels() {
+  using Kernels = FixedKernels<Type, Order>;
+  ElementKernels kernels{&Kernels::square, nullptr, true};
+  if constexpr (Kernels::lift_cols > 0) kernels.lift = &Kernels::lift;
+  return kernels;
+}
+
+/// The kernels of `Type` and `order`, looked up among the instantiated `Orders + 1`.
+template <RefElementType Type, unsigned... Orders>
+ElementKernels fixed_kernels(unsigned order, std::integer_sequence<unsigned, Orders...>) {
+  ElementKernels kernels;
+  ((order == Orders + 1 && (kernels = fixed_kernels<Type, Orders + 1>(), true)) || ...);
+  return kernels;
+}
+
+template <RefElementType Type>
+ElementKernels fixed_kernels(unsigned order) {
+  return fixed_kernels<Type>(order, std::make_integer_sequence<unsigned, max_specialized_order>{});
+}
+
+}  // namespace
+
+ElementKernels get_element_kernels(RefElementType type, unsigned order) {
+  if (order == 0) throw std::invalid_argument("Order must be greater than 0");
+  if (order > max_specialized_order) {
+    const bool has_lift = detail::lift_columns(type, order) > 0;
+    return {&detail::apply_dynamic, has_lift ? &detail::apply_dynamic : nullptr, false};
+  }
+  switch (type) {
+  case RefElementType::Line:
+    return fixed_kernels<RefElementType::Line>(order);
+  case RefElementType::Triangle:
+    return fixed_kernels<RefElementType::Triangle>(order);
+  case RefElementType::Quadrilateral:
+    return fixed_kernels<RefElementType::Quadrilateral>(order);
+  case RefElementType::Tetrahedron:
+    return fixed_kernels<RefElementType::Tetrahedron>(order);
+  case RefElementType::Hexahedron:
+    return fixed_kernels<RefElementType::Hexahedron>(order);
+  case RefElementType::Prism:
+    return fixed_kernels<RefElementType::Prism>(order);
+  case RefElementType::Pyramid:
+    return fixed_kernels<RefElementType::Pyramid>(order);
+  }
+  throw std::invalid_argument("Unknown element type");
+}
+
+void batched_apply(OperatorKernel kernel, const utils::AlignedMatrix& a, const double* x,
+                   double* y, std::size_t n_elements, GemmBackend backend) {
+  if (n_elements == 0 || a.empty()) return;
+  if (backend == GemmBackend::Blas) {
+#ifdef WITH_OPENBLAS
+    // Row-major transposes of the column-major block matrices: Yᵀ = Xᵀ Aᵀ.
+    const auto n = static_cast<blasint>(n_elements);
+    const auto rows = static_cast<blasint>(a.rows());
+    const auto cols = static_cast<blasint>(a.cols());
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasTrans, n, rows, cols, 1.0, x, cols, a.data(),
+                static_cast<blasint>(a.stride()), 0.0, y, rows);
+    return;
+#else
+    throw std::invalid_argument("batched_apply: oiseau was built without a BLAS backend");
+#endif
+  }
+  // Chunks hold whole blocks of `kernel_lanes` elements, so only the last one is partial.
+  const std::size_t entries = a.rows() * a.cols();
+  const std::size_t lanes = detail::kernel_lanes;
+  const std::size_t min_chunk = (detail::parallel_grain / entries + lanes - 1) / lanes * lanes;
+  const std::size_t chunk = std::max(lanes, min_chunk);
+  const std::size_t n_chunks = (n_elements + chunk - 1) / chunk;
+  utils::parallel_for(n_chunks, [&](std::size_t c) {
+    const std::size_t begin = c * chunk;
+    const std::size_t end = std::min(n_elements, begin + chunk);
+    kernel(a, x + begin * a.cols(), y + begin * a.rows(), end - begin);
+  });
+}
+
+BlockOperators::BlockOperators(RefElementType type, unsigned order, GemmBackend backend)
+    : m_reference(get_ref_element(type, order)),
+      m_kernels(get_element_kernels(type, order)),
+      m_backend(backend) {
+  if (backend == GemmBackend::Blas && !has_blas_backend()) {
+    throw std::invalid_argument("BlockOperators: oiseau was built without a BLAS backend");
+  }
+}
+
+void BlockOperators::d(std::size_t axis, std::span<const double> u, std::span<double> out) const {
+  const auto& d = m_reference->packed().d;
+  if (axis >= d.size()) throw std::invalid_argument("BlockOperators: invalid derivative axis");
+  apply(m_kernels.square, d[axis], u, out);
+}
+
+void BlockOperators::mass(std::span<const double> u, std::span<double> out) const {
+  apply(m_kernels.square, m_reference->packed().mass, u, out);
+}
+
+void BlockOperators::inv_mass(std::span<const double> u, std::span<double> out) const {
+  apply(m_kernels.square, m_reference->packed().inv_mass, u, out);
+}
+
+void BlockOperators::lift(std::span<const double> flux, std::span<double> out) const {
+  if (m_kernels.lift == nullptr) {
+    throw std::invalid_argument("BlockOperators: the element has no LIFT operator");
+  }
+  apply(m_kernels.lift, m_reference->packed().lift, flux, out);
+}
+
+void BlockOperators::apply(OperatorKernel kernel, const utils::AlignedMatrix& a,
+                           std::span<const double> x, std::span<double> y) const {
+  const std::size_t n_elements = x.size() / a.cols();
+  if (x.size() % a.cols() != 0 || y.size() != n_elements * a.rows()) {
+    throw std::invalid_argument("BlockOperators: nodal values do not match the operator");
+  }
+  batched_apply(kernel, a, x.data(), y.data(), n_elements, m_backend);
+}
+
+}  // namespace oiseau::dg::nodal
@@ -0,0 +1,264 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/utils/aligned_matrix.hpp"
+
+/**
+ * @file kernels.hpp
+ * @brief Application of the reference operators to blocks of elements of one type and order.
+ *
+ * Nodal values are stored element by element: the values of element `e` of a block start at
+ * `e * cols`, where `cols` is the number of columns of the applied operator. For orders up to
+ * `max_specialized_order` the operator sizes are template parameters, so every loop bound and
+ * stride is a compile-time constant; higher orders share one generic kernel.
+ *
+ * Seen as matrices, a block of `K` elements is a column-major `cols × K` matrix `X` and every
+ * operator application is one product `Y = A X`. Large blocks are split into chunks of
+ * elements that run on the default thread pool, or are handed to BLAS in a single `dgemm`.
+ */
+
+namespace oiseau::dg::nodal {
+
+/// Highest order with kernels specialized at compile time.
+inline constexpr unsigned max_specialized_order = 10;
+
+/// Applies the packed operator `a` to `n_elements` elements: `y_e = a x_e`.
+using OperatorKernel = void (*)(const utils::AlignedMatrix& a, const double* x, double* y,
+                                std::size_t n_elements);
+
+/// Implementation of the batched products `Y = A X`.
+enum class GemmBackend {
+  Kernels,  ///< The kernels of this file, run on the default thread pool.
+  Blas,     ///< One `dgemm` call; requires a BLAS backend, see `has_blas_backend`.
+};
+
+/// Whether the library was built against a CBLAS implementation (OpenBLAS).
+bool has_blas_backend();
+
+namespace detail {
+
+/// Number of nodes of the reference element of `type` and `order`.
+constexpr std::size_t node_count(RefElementType type, unsigned order) {
+  const std::size_t p = order;
+  switch (type) {
+  case RefElementType::Line:
+    return p + 1;
+  case RefElementType::Triangle:
+    return (p + 1) * (p + 2) / 2;
+  case RefElementType::Quadrilateral:
+    return (p + 1) * (p + 1);
+  case RefElementType::Tetrahedron:
+    return (p + 1) * (p + 2) * (p + 3) / 6;
+  case RefElementType::Hexahedron:
+    return (p + 1) * (p + 1) * (p + 1);
+  case RefElementType::Prism:
+    return (p + 1) * (p + 1) * (p + 2) / 2;
+  case RefElementType::Pyramid:
+    return (p + 1) * (p + 2) * (2 * p + 3) / 6;
+  }
+  return 0;
+}
+
+/// Number of columns of the LIFT operator, faces times face nodes; 0 for prisms and pyramids.
+constexpr std::size_t lift_columns(RefElementType type, unsigned order) {
+  const std::size_t p = order;
+  switch (type) {
+  case RefElementType::Line:
+    return 2;
+  case RefElementType::Triangle:
+    return 3 * (p + 1);
+  case RefElementType::Quadrilateral:
+    return 4 * (p + 1);
+  case RefElementType::Tetrahedron:
+    return 4 * (p + 1) * (p + 2) / 2;
+  case RefElementType::Hexahedron:
+    return 6 * (p + 1) * (p + 1);
+  default:
+    return 0;
+  }
+}
+
+/// One node of every element of a block, held in vector registers (GCC and Clang vectors).
+using lane_vector = double __attribute__((vector_size(utils::matrix_alignment)));
+/// Elements processed together by `apply_blocked`.
+inline constexpr std::size_t kernel_lanes = sizeof(lane_vector) / sizeof(double);
+/// Operator rows accumulated together in registers.
+inline constexpr std::size_t kernel_rows = 4;
+/// Operators up to this many entries are applied element by element, fully unrolled.
+inline constexpr std::size_t direct_entries = 64;
+
+/**
+ * @brief `y_e = A x_e` for `n_elements` elements; `x` and `y` must not overlap.
+ *
+ * Each block of `kernel_lanes` elements is transposed into `xs` (`cols` vectors), so every
+ * operator entry is broadcast against a vector holding one node of all elements while
+ * `kernel_rows` rows accumulate in registers; the results go through `ys` (`rows` vectors).
+ * The sizes are `std::integral_constant`s in the specialized kernels and integers otherwise.
+ */
+template <class Rows, class Cols, class Lda>
+void apply_blocked(const double* a, Lda lda, Rows rows, Cols cols, const double* x, double* y,
+                   std::size_t n_elements, lane_vector* xs, lane_vector* ys) {
+  for (std::size_t e0 = 0; e0 < n_elements; e0 += kernel_lanes) {
+    const std::size_t n = std::min(kernel_lanes, n_elements - e0);
+    for (std::size_t k = 0; k < n; ++k) {
+      const double* xe = x + (e0 + k) * cols;
+      for (std::size_t j = 0; j < cols; ++j) xs[j][k] = xe[j];
+    }
+    for (std::size_t k = n; k < kernel_lanes; ++k) {
+      for (std::size_t j = 0; j < cols; ++j) xs[j][k] = 0.0;
+    }
+
+    std::size_t i = 0;
+    for (; i + kernel_rows <= rows; i += kernel_rows) {
+      lane_vector acc[kernel_rows] = {};
+      for (std::size_t j = 0; j < cols; ++j) {
+        for (std::size_t r = 0; r < kernel_rows; ++r) acc[r] += a[(i + r) * lda + j] * xs[j];
+      }
+      for (std::size_t r = 0; r < kernel_rows; ++r) ys[i + r] = acc[r];
+    }
+    for (; i < rows; ++i) {
+      lane_vector acc = {};
+      for (std::size_t j = 0; j < cols; ++j) acc += a[i * lda + j] * xs[j];
+      ys[i] = acc;
+    }
+
+    for (std::size_t k = 0; k < n; ++k) {
+      double* ye = y + (e0 + k) * rows;
+      for (std::size_t r = 0; r < rows; ++r) ye[r] = ys[r][k];
+    }
+  }
+}
+
+/**
+ * @brief `apply_blocked` with `Rows × Cols` fixed at compile time.
+ *
+ * Operators of at most `direct_entries` entries skip the transposition, which would cost as
+ * much as the product, and are applied element by element with fully unrolled loops.
+ */
+template <std::size_t Rows, std::size_t Cols>
+void apply_fixed(const utils::AlignedMatrix& a, const double* x, double* y,
+                 std::size_t n_elements) {
+  constexpr std::size_t lda = utils::AlignedMatrix::padded(Cols);
+  if constexpr (Rows * Cols <= direct_entries) {
+    const double* __restrict ad = a.data();
+    for (std::size_t e = 0; e < n_elements; ++e) {
+      const double* __restrict xe = x + e * Cols;
+      double* __restrict ye = y + e * Rows;
+      for (std::size_t i = 0; i < Rows; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < Cols; ++j) sum += ad[i * lda + j] * xe[j];
+        ye[i] = sum;
+      }
+    }
+  } else {
+    lane_vector xs[Cols];
+    lane_vector ys[Rows];
+    apply_blocked(a.data(), std::integral_constant<std::size_t, lda>{},
+                  std::integral_constant<std::size_t, Rows>{},
+                  std::integral_constant<std::size_t, Cols>{}, x, y, n_elements, xs, ys);
+  }
+}
+
+/// `apply_blocked` for operators of any size.
+void apply_dynamic(const utils::AlignedMatrix& a, const double* x, double* y,
+                   std::size_t n_elements);
+
+/// Operator entries times elements below which a block is not split across threads.
+inline constexpr std::size_t parallel_grain = std::size_t{1} << 16;
+
+}  // namespace detail
+
+/**
+ * @brief Kernels of the reference element of `Type` and `Order`.
+ *
+ * Usable directly when the order is known at compile time; `get_element_kernels` dispatches
+ * to them at run time.
+ */
+template <RefElementType Type, unsigned Order>
+struct FixedKernels {
+  static constexpr std::size_t np = detail::node_count(Type, Order);
+  static constexpr std::size_t lift_cols = detail::lift_columns(Type, Order);
+
+  /// For the `np × np` operators: derivatives, mass and inverse mass.
+  static void square(const utils::AlignedMatrix& a, const double* x, double* y,
+                     std::size_t n_elements) {
+    detail::apply_fixed<np, np>(a, x, y, n_elements);
+  }
+
+  /// For the `np × lift_cols` LIFT operator.
+  static void lift(const utils::AlignedMatrix& a, const double* x, double* y,
+                   std::size_t n_elements)
+    requires(lift_cols > 0)
+  {
+    detail::apply_fixed<np, lift_cols>(a, x, y, n_elements);
+  }
+};
+
+/// The kernels used for one reference element type and order.
+struct ElementKernels {
+  OperatorKernel square = nullptr;  ///< For the `np × np` operators.
+  OperatorKernel lift = nullptr;    ///< For LIFT; null for prisms and pyramids.
+  bool specialized = false;         ///< Whether the sizes are compile-time constants.
+};
+
+/// The kernels of `type` and `order`; generic ones above `max_specialized_order`.
+ElementKernels get_element_kernels(RefElementType type, unsigned order);
+
+/**
+ * @brief `y_e = a x_e` for `n_elements` elements, as the product of `a` and the block matrix.
+ *
+ * With `GemmBackend::Kernels`, chunks of at least `detail::parallel_grain / a.size()` elements
+ * are processed by `kernel` in parallel; with `GemmBackend::Blas`, which throws
+ * `std::invalid_argument` when `has_blas_backend()` is false, `kernel` is not used.
+ */
+void batched_apply(OperatorKernel kernel, const utils::AlignedMatrix& a, const double* x,
+                   double* y, std::size_t n_elements, GemmBackend backend = GemmBackend::Kernels);
+
+/**
+ * @class BlockOperators
+ * @brief Applies the reference operators of one element type and order to blocks of elements.
+ *
+ * The kernels are selected once, on construction, and read the aligned operators of
+ * `RefElement::packed`; every call is one `batched_apply` over the whole block. The spans
+ * hold the nodal values of whole elements; a size that is not a multiple of the operator size
+ * throws `std::invalid_argument`.
+ */
+class BlockOperators {
+ public:
+  /// Throws `std::invalid_argument` for `GemmBackend::Blas` without a BLAS backend.
+  BlockOperators(RefElementType type, unsigned order,
+                 GemmBackend backend = GemmBackend::Kernels);
+
+  inline const RefElement& reference() const { return *m_reference; }
+  inline bool specialized() const { return m_kernels.specialized; }
+  inline GemmBackend backend() const { return m_backend; }
+
+  /// Derivative along reference axis `axis`.
+  void d(std::size_t axis, std::span<const double> u, std::span<double> out) const;
+  void mass(std::span<const double> u, std::span<double> out) const;
+  void inv_mass(std::span<const double> u, std::span<double> out) const;
+  /// Lifts face values, `n_faces · nfp` per element in face order, into the elements.
+  void lift(std::span<const double> flux, std::span<double> out) const;
+
+ private:
+  void apply(OperatorKernel kernel, const utils::AlignedMatrix& a, std::span<const double> x,
+             std::span<double> y) const;
+
+  std::shared_ptr<RefElement> m_reference;
+  ElementKernels m_kernels;
+  GemmBackend m_backend;
+};
+
+}  // namespace oiseau::dg::nodal
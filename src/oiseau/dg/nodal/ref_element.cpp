@@ -6,21 +6,105 @@
 
 #include "oiseau/dg/nodal/ref_element.hpp"
 
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xslice.hpp>
+#include <xtensor/views/xview.hpp>
 
 #include "oiseau/dg/nodal/ref_hexahedron.hpp"
 #include "oiseau/dg/nodal/ref_line.hpp"
+#include "oiseau/dg/nodal/ref_prism.hpp"
+#include "oiseau/dg/nodal/ref_pyramid.hpp"
 #include "oiseau/dg/nodal/ref_quadrilateral.hpp"
 #include "oiseau/dg/nodal/ref_tetrahedron.hpp"
 #include "oiseau/dg/nodal/ref_triangle.hpp"
+#include "oiseau/utils/aligned_matrix.hpp"
 
 namespace oiseau::dg::nodal {
 
+namespace {
+
+/// Distance below which a node lies on a face.
+constexpr double face_tolerance = 1e-10;
+
+}  // namespace
+
+void RefElement::init_mass() {
+  m_inv_mass = xt::linalg::dot(m_v, xt::transpose(m_v));
+  m_mass = xt::linalg::inv(m_inv_mass);
+}
+
+void RefElement::init_face_operators(std::span<const detail::RefFace> faces,
+                                     const RefElement* face_element) {
+  const std::size_t np = m_np;
+  const std::size_t nfp = m_nfp;
+  const std::size_t n_faces = faces.size();
+  const std::size_t dim = m_r.dimension() == 1 ? 1 : m_r.shape()[1];
+  const auto coordinate = [&](std::size_t node, std::size_t axis) {
+    return dim == 1 ? m_r(node) : m_r(node, axis);
+  };
+
+  m_fmask = xt::zeros<std::size_t>({n_faces, nfp});
+  m_face_mass = xt::zeros<double>({n_faces, nfp, nfp});
+  xt::xarray<double> emat = xt::zeros<double>({np, n_faces * nfp});
+  for (std::size_t f = 0; f < n_faces; ++f) {
+    const detail::RefFace& face = faces[f];
+    const std::size_t n_axes = face.axes.size();
+    xt::xarray<double> coords =
+        n_axes == 1 ? xt::xarray<double>(xt::zeros<double>({nfp}))
+                    : xt::xarray<double>(xt::zeros<double>({nfp, n_axes}));
+    std::size_t count = 0;
+    for (std::size_t node = 0; node < np; ++node) {
+      double value = 0.0;
+      for (std::size_t k = 0; k < dim; ++k) value += face.normal[k] * coordinate(node, k);
+      if (std::abs(value - face.offset) > face_tolerance) continue;
+      if (count == nfp) throw std::runtime_error("Reference face holds too many nodes");
+      m_fmask(f, count) = node;
+      if (n_axes == 1) {
+        coords(count) = coordinate(node, face.axes[0]);
+      } else {
+        for (std::size_t a = 0; a < n_axes; ++a) coords(count, a) = coordinate(node, face.axes[a]);
+      }
+      ++count;
+    }
+    if (count != nfp) throw std::runtime_error("Reference face holds too few nodes");
+
+    xt::xarray<double> face_mass = xt::ones<double>({std::size_t{1}, std::size_t{1}});
+    if (face_element != nullptr) {
+      const xt::xarray<double> vf = face_element->vandermonde(coords);
+      face_mass = xt::linalg::inv(xt::linalg::dot(vf, xt::transpose(vf)));
+    }
+    xt::view(m_face_mass, f, xt::all(), xt::all()) = face_mass;
+    for (std::size_t i = 0; i < nfp; ++i) {
+      for (std::size_t j = 0; j < nfp; ++j) emat(m_fmask(f, i), f * nfp + j) = face_mass(i, j);
+    }
+  }
+  m_lift = xt::linalg::dot(m_inv_mass, emat);
+}
+
+void RefElement::pack_operators() {
+  m_packed.d.clear();
+  if (m_d.dimension() == 2) {
+    m_packed.d.push_back(utils::AlignedMatrix::from(m_d));
+  } else {
+    for (std::size_t axis = 0; axis < m_d.shape()[2]; ++axis) {
+      m_packed.d.push_back(utils::AlignedMatrix::from(xt::view(m_d, xt::all(), xt::all(), axis)));
+    }
+  }
+  m_packed.mass = utils::AlignedMatrix::from(m_mass);
+  m_packed.inv_mass = utils::AlignedMatrix::from(m_inv_mass);
+  if (m_lift.dimension() == 2) m_packed.lift = utils::AlignedMatrix::from(m_lift);
+}
+
 std::shared_ptr<RefElement> get_ref_element(RefElementType type, unsigned order) {
   using Key = std::pair<RefElementType, unsigned>;
 
@@ -55,6 +139,12 @@ std::shared_ptr<RefElement> get_ref_element(RefElementType type, unsigned order)
   case RefElementType::Hexahedron:
     elem = std::make_shared<RefHexahedron>(order);
     break;
+  case RefElementType::Prism:
+    elem = std::make_shared<RefPrism>(order);
+    break;
+  case RefElementType::Pyramid:
+    elem = std::make_shared<RefPyramid>(order);
+    break;
   default:
     throw std::invalid_argument("Unknown element type");
   }
@@ -6,16 +6,66 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <stdexcept>
+#include <vector>
 #include <xtensor/containers/xarray.hpp>
 
+#include "oiseau/utils/aligned_matrix.hpp"
 #include "xtensor/core/xtensor_forward.hpp"
 
 namespace oiseau::dg::nodal {
 
-enum class RefElementType { Line, Triangle, Quadrilateral, Tetrahedron, Hexahedron };
+enum class RefElementType {
+  Line,
+  Triangle,
+  Quadrilateral,
+  Tetrahedron,
+  Hexahedron,
+  Prism,
+  Pyramid
+};
+
+namespace detail {
+
+/**
+ * @brief A planar face of a reference element.
+ *
+ * The face holds the nodes with `normal · r == offset` and is parametrized by the reference
+ * coordinates listed in `axes`, which are the coordinates of its own reference element.
+ */
+struct RefFace {
+  std::array<double, 3> normal;
+  double offset;
+  std::vector<std::size_t> axes;
+};
+
+}  // namespace detail
 
+/**
+ * @brief Reference operators in aligned, padded row-major storage for the application kernels.
+ *
+ * These are copies of the `xt::xarray` operators of `RefElement`, which stay the interface for
+ * setup code; kernels read these through fixed-stride `mdspan` views.
+ */
+struct PackedOperators {
+  std::vector<utils::AlignedMatrix> d;  ///< One `np × np` derivative matrix per reference axis.
+  utils::AlignedMatrix mass;
+  utils::AlignedMatrix inv_mass;
+  utils::AlignedMatrix lift;  ///< Empty for prisms and pyramids.
+};
+
+/**
+ * @class RefElement
+ * @brief Nodal reference element and the operators derived from its Vandermonde matrix.
+ *
+ * All operators are computed once in the constructor; `get_ref_element` shares a single
+ * instance per type and order. Faces are numbered as the facets of the matching mesh cell.
+ * Prisms and pyramids mix face types and only carry the mass matrices.
+ */
 class RefElement {
  public:
   virtual ~RefElement() = default;
@@ -25,6 +75,19 @@ class RefElement {
   inline const xt::xarray<double>& d() const { return m_d; }
   inline const xt::xarray<double>& r() const { return m_r; }
 
+  /// Mass matrix `(V Vᵀ)⁻¹`, `np × np`.
+  inline const xt::xarray<double>& mass() const { return m_mass; }
+  /// Inverse mass matrix `V Vᵀ`, `np × np`.
+  inline const xt::xarray<double>& inv_mass() const { return m_inv_mass; }
+  /// Indices of the nodes on each face in ascending order, `n_faces × nfp`.
+  inline const xt::xarray<std::size_t>& fmask() const { return m_fmask; }
+  /// Mass matrix of each face in the coordinates of its reference element, `n_faces × nfp × nfp`.
+  inline const xt::xarray<double>& face_mass() const { return m_face_mass; }
+  /// Lifts face values into the element, `M⁻¹ E`, `np × (n_faces · nfp)`.
+  inline const xt::xarray<double>& lift() const { return m_lift; }
+  /// Aligned copies of `d`, `mass`, `inv_mass` and `lift`.
+  inline const PackedOperators& packed() const { return m_packed; }
+
   inline unsigned order() const { return m_order; }
   inline unsigned number_of_nodes() const { return m_np; }
   inline unsigned number_of_face_nodes() const { return m_nfp; }
@@ -36,6 +99,20 @@ class RefElement {
     if (order == 0) throw std::invalid_argument("Order must be greater than 0");
   }
 
+  /// Sets the mass and inverse mass matrices from `m_v`.
+  void init_mass();
+
+  /**
+   * @brief Sets `m_fmask`, `m_face_mass` and `m_lift`; requires `init_mass`.
+   * @param faces The faces of the element, in facet order.
+   * @param face_element Reference element of the faces, or `nullptr` for point faces.
+   */
+  void init_face_operators(std::span<const detail::RefFace> faces,
+                           const RefElement* face_element);
+
+  /// Sets `m_packed` from the finished operators; the last step of every constructor.
+  void pack_operators();
+
   unsigned m_order;
   unsigned m_np{};
   unsigned m_nfp{};
@@ -43,6 +120,12 @@ class RefElement {
   xt::xarray<double> m_gv;
   xt::xarray<double> m_d;
   xt::xarray<double> m_r;
+  xt::xarray<double> m_mass;
+  xt::xarray<double> m_inv_mass;
+  xt::xarray<std::size_t> m_fmask;
+  xt::xarray<double> m_face_mass;
+  xt::xarray<double> m_lift;
+  PackedOperators m_packed;
 };
 
 std::shared_ptr<RefElement> get_ref_element(RefElementType type, unsigned order);
@@ -6,6 +6,7 @@
 
 #include "oiseau/dg/nodal/ref_line.hpp"
 
+#include <array>
 #include <cstddef>
 #include <xtensor-blas/xlinalg.hpp>
 #include <xtensor/core/xshape.hpp>
@@ -28,6 +29,13 @@ RefLine::RefLine(unsigned order) : RefElement(order) {
   this->m_v = this->vandermonde(this->m_r);
   this->m_gv = this->grad_vandermonde(this->m_r);
   this->m_d = this->grad_operator(this->m_v, this->m_gv);
+  this->init_mass();
+  const std::array<detail::RefFace, 2> faces = {{
+      {{1.0, 0.0, 0.0}, -1.0, {}},
+      {{1.0, 0.0, 0.0}, 1.0, {}},
+  }};
+  this->init_face_operators(faces, nullptr);
+  this->pack_operators();
 }
 
 xt::xarray<double> RefLine::basis_function(const xt::xarray<double>& r, int i) {
@@ -0,0 +1,133 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nodal/ref_prism.hpp"
+
+#include <cstddef>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/core/xshape.hpp>
+#include <xtensor/core/xtensor_forward.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xslice.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/ref_triangle.hpp"
+#include "oiseau/dg/nodal/utils.hpp"
+#include "oiseau/utils/math.hpp"
+
+namespace oiseau::dg::nodal {
+
+RefPrism::RefPrism(unsigned order) : RefElement(order) {
+  this->m_np = (order + 1) * (order + 1) * (order + 2) / 2;
+  this->m_nfp = (order + 1) * (order + 1);
+  this->m_r = detail::generate_prism_nodes(this->m_order);
+  this->m_v = this->vandermonde(this->m_r);
+  this->m_gv = this->grad_vandermonde(this->m_r);
+  this->m_d = this->grad_operator(this->m_v, this->m_gv);
+  this->init_mass();
+  this->pack_operators();
+}
+
+xt::xarray<double> RefPrism::basis_function(const xt::xarray<double> &rst, int i, int j, int k) {
+  xt::xarray<double> rs = xt::view(rst, xt::all(), xt::range(0, 2));
+  xt::xarray<double> t = xt::col(rst, 2);
+  auto psi = RefTriangle::basis_function(detail::rs_to_ab(rs), i, j);
+  auto h = oiseau::utils::jacobi_p(k, 0.0, 0.0, t);
+  return psi * h;
+}
+
+xt::xarray<double> RefPrism::grad_basis_function(const xt::xarray<double> &rst, int i, int j,
+                                                 int k) {
+  xt::xarray<double> rs = xt::view(rst, xt::all(), xt::range(0, 2));
+  xt::xarray<double> t = xt::col(rst, 2);
+  const auto ab = detail::rs_to_ab(rs);
+
+  xt::xarray<double> psi = RefTriangle::basis_function(ab, i, j);
+  xt::xarray<double> dpsi = RefTriangle::grad_basis_function(ab, i, j);
+  xt::xarray<double> h = oiseau::utils::jacobi_p(k, 0.0, 0.0, t);
+  xt::xarray<double> dh = oiseau::utils::grad_jacobi_p(k, 0.0, 0.0, t);
+
+  xt::xarray<double> dphidr = xt::col(dpsi, 0) * h;
+  xt::xarray<double> dphids = xt::col(dpsi, 1) * h;
+  xt::xarray<double> dphidt = psi * dh;
+  return xt::stack(xt::xtuple(dphidr, dphids, dphidt), 1);
+}
+
+xt::xarray<double> RefPrism::vandermonde(const xt::xarray<double> &rst) const {
+  const std::size_t n_points = rst.shape()[0];
+  const std::size_t n_basis = this->m_np;  // (order+1)^2 (order+2)/2
+
+  xt::xarray<double> output(xt::dynamic_shape<std::size_t>({n_points, n_basis}));
+  std::size_t index = 0;
+  for (unsigned i = 0; i <= this->m_order; ++i) {
+    for (unsigned j = 0; j <= this->m_order - i; ++j) {
+      for (unsigned k = 0; k <= this->m_order; ++k, ++index) {
+        xt::col(output, index) = basis_function(rst, i, j, k);
+      }
+    }
+  }
+  return output;
+}
+
+xt::xarray<double> RefPrism::grad_vandermonde(const xt::xarray<double> &rst) const {
+  const std::size_t n_points = rst.shape()[0];
+  const std::size_t n_basis = this->m_np;  // (order+1)^2 (order+2)/2
+
+  xt::xarray<double> output(xt::dynamic_shape<std::size_t>({n_points, n_basis, 3}));
+  std::size_t index = 0;
+  for (unsigned i = 0; i <= this->m_order; ++i) {
+    for (unsigned j = 0; j <= this->m_order - i; ++j) {
+      for (unsigned k = 0; k <= this->m_order; ++k, ++index) {
+        xt::view(output, xt::all(), index, xt::all()) = grad_basis_function(rst, i, j, k);
+      }
+    }
+  }
+  return output;
+}
+
+xt::xarray<double> RefPrism::grad_operator(const xt::xarray<double> &v,
+                                           const xt::xarray<double> &gv) const {
+  auto gvr = xt::view(gv, xt::all(), xt::all(), 0);
+  auto gvs = xt::view(gv, xt::all(), xt::all(), 1);
+  auto gvt = xt::view(gv, xt::all(), xt::all(), 2);
+
+  const auto vt = xt::transpose(v);
+  const auto dvt_dr = xt::transpose(gvr);
+  const auto dvt_ds = xt::transpose(gvs);
+  const auto dvt_dt = xt::transpose(gvt);
+
+  const auto dr = xt::transpose(xt::linalg::solve(vt, dvt_dr));
+  const auto ds = xt::transpose(xt::linalg::solve(vt, dvt_ds));
+  const auto dt = xt::transpose(xt::linalg::solve(vt, dvt_dt));
+
+  return xt::stack(xt::xtuple(dr, ds, dt), 2);
+}
+
+}  // namespace oiseau::dg::nodal
+
+namespace oiseau::dg::nodal::detail {
+
+xt::xarray<double> generate_prism_nodes(unsigned order) {
+  const xt::xarray<double> rs = equilateral_xy_to_rs(generate_triangle_nodes(order));
+  const xt::xarray<double> t1d = utils::jacobi_gl(order, 0.0, 0.0);
+  const std::size_t n_tri = rs.shape()[0];
+
+  auto shape = xt::xarray<double>::shape_type{n_tri * t1d.size(), 3};
+  xt::xarray<double> output = xt::zeros<double>(shape);
+  std::size_t n = 0;
+  for (std::size_t k = 0; k < t1d.size(); ++k) {
+    for (std::size_t p = 0; p < n_tri; ++p, ++n) {
+      output(n, 0) = rs(p, 0);
+      output(n, 1) = rs(p, 1);
+      output(n, 2) = t1d(k);
+    }
+  }
+  return output;
+}
+
+}  // namespace oiseau::dg::nodal::detail
@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <xtensor/core/xtensor_forward.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+
+/**
+ * @file ref_prism.hpp
+ * @brief Defines the reference triangular prism used in nodal Discontinuous Galerkin methods.
+ */
+
+namespace oiseau::dg::nodal {
+
+/**
+ * @class RefPrism
+ * @brief Reference prism { (r,s,t) | r,s >= -1, r+s <= 0, -1 <= t <= 1 }.
+ *
+ * The approximation space is P_N(r,s) ⊗ P_N(t): the orthonormal triangle basis of `RefTriangle`
+ * times Legendre polynomials in t. Nodes are the Warp & Blend triangle nodes extruded along the
+ * Gauss-Lobatto points in t, so the two triangular faces carry triangle nodes and the three
+ * quadrilateral faces carry tensor Gauss-Lobatto nodes.
+ */
+class RefPrism : public RefElement {
+ public:
+  explicit RefPrism(unsigned order);
+
+  /**
+   * @brief Evaluates the orthonormal basis function
+   *        \f$\psi_{ij}(r,s)\,P_k(t)\f$, with \f$i+j \le N\f$ and \f$k \le N\f$.
+   *
+   * @param rst 2D array (shape: N_points × 3) of (r, s, t) coordinates.
+   * @return    1D array (length N_points) of basis function values.
+   */
+  static xt::xarray<double> basis_function(const xt::xarray<double>& rst, int i, int j, int k);
+
+  /**
+   * @brief Computes the gradient of a basis function with respect to (r, s, t).
+   *
+   * @param rst 2D array (shape: N_points × 3) of (r, s, t) coordinates.
+   * @return    2D array (shape: N_points × 3) containing (∂/∂r, ∂/∂s, ∂/∂t) for each point.
+   */
+  static xt::xarray<double> grad_basis_function(const xt::xarray<double>& rst, int i, int j,
+                                                int k);
+
+ private:
+  xt::xarray<double> vandermonde(const xt::xarray<double>& rst) const;
+  xt::xarray<double> grad_vandermonde(const xt::xarray<double>& rst) const;
+  xt::xarray<double> grad_operator(const xt::xarray<double>& v, const xt::xarray<double>& gv) const;
+};
+
+namespace detail {
+
+/**
+ * @brief Generates the nodes of the reference prism, layer by layer along t.
+ *
+ * @param order Polynomial order (number of points = (order+1)^2 (order+2)/2).
+ * @return      2D array (N_points × 3) of (r, s, t) coordinates.
+ */
+xt::xarray<double> generate_prism_nodes(unsigned order);
+
+}  // namespace detail
+}  // namespace oiseau::dg::nodal
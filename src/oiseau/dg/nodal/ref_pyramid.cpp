@@ -0,0 +1,172 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nodal/ref_pyramid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/core/xmath.hpp>
+#include <xtensor/core/xoperation.hpp>
+#include <xtensor/core/xshape.hpp>
+#include <xtensor/core/xtensor_forward.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xslice.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/utils.hpp"
+#include "oiseau/utils/math.hpp"
+
+namespace oiseau::dg::nodal {
+
+RefPyramid::RefPyramid(unsigned order) : RefElement(order) {
+  this->m_np = (order + 1) * (order + 2) * (2 * order + 3) / 6;
+  this->m_nfp = (order + 1) * (order + 1);
+  this->m_r = detail::generate_pyramid_nodes(this->m_order);
+  this->m_v = this->vandermonde(this->m_r);
+  this->m_gv = this->grad_vandermonde(this->m_r);
+  this->m_d = this->grad_operator(this->m_v, this->m_gv);
+  this->init_mass();
+  this->pack_operators();
+}
+
+xt::xarray<double> RefPyramid::basis_function(const xt::xarray<double> &abc, int i, int j,
+                                              int k) {
+  xt::xarray<double> a = xt::col(abc, 0);
+  xt::xarray<double> b = xt::col(abc, 1);
+  xt::xarray<double> c = xt::col(abc, 2);
+  const int m = std::max(i, j);
+  auto h1 = oiseau::utils::jacobi_p(i, 0.0, 0.0, a);
+  auto h2 = oiseau::utils::jacobi_p(j, 0.0, 0.0, b);
+  auto h3 = oiseau::utils::jacobi_p(k, 2.0 * m + 2.0, 0.0, c);
+  return std::pow(2.0, m + 1) * h1 * h2 * xt::pow(0.5 * (1 - c), m) * h3;
+}
+
+xt::xarray<double> RefPyramid::grad_basis_function(const xt::xarray<double> &abc, int i, int j,
+                                                   int k) {
+  xt::xarray<double> a = xt::col(abc, 0);
+  xt::xarray<double> b = xt::col(abc, 1);
+  xt::xarray<double> c = xt::col(abc, 2);
+  const int m = std::max(i, j);
+
+  xt::xarray<double> fa = oiseau::utils::jacobi_p(i, 0.0, 0.0, a);
+  xt::xarray<double> dfa = oiseau::utils::grad_jacobi_p(i, 0.0, 0.0, a);
+  xt::xarray<double> gb = oiseau::utils::jacobi_p(j, 0.0, 0.0, b);
+  xt::xarray<double> dgb = oiseau::utils::grad_jacobi_p(j, 0.0, 0.0, b);
+  xt::xarray<double> hc = oiseau::utils::jacobi_p(k, 2.0 * m + 2.0, 0.0, c);
+  xt::xarray<double> dhc = oiseau::utils::grad_jacobi_p(k, 2.0 * m + 2.0, 0.0, c);
+
+  // ∂a/∂r = ∂b/∂s = 1 / ((1-c)/2), which lowers the power of the collapse factor by one.
+  xt::xarray<double> h = 0.5 * (1 - c);
+  xt::xarray<double> hm = xt::pow(h, m);
+  xt::xarray<double> hm1 = xt::zeros_like(h);
+  if (m > 0) hm1 = xt::pow(h, m - 1);
+
+  const double scale = std::pow(2.0, m + 1);
+  xt::xarray<double> dphidr = scale * dfa * gb * hm1 * hc;
+  xt::xarray<double> dphids = scale * fa * dgb * hm1 * hc;
+  xt::xarray<double> dphidt =
+      0.5 * (a * dphidr + b * dphids) + scale * fa * gb * (hm * dhc - 0.5 * m * hm1 * hc);
+
+  return xt::stack(xt::xtuple(dphidr, dphids, dphidt), 1);
+}
+
+xt::xarray<double> RefPyramid::vandermonde(const xt::xarray<double> &rst) const {
+  const auto abc = detail::pyramid_rst_to_abc(rst);
+  const std::size_t n_points = rst.shape()[0];
+  const std::size_t n_basis = this->m_np;  // (order+1)(order+2)(2*order+3)/6
+
+  xt::xarray<double> output(xt::dynamic_shape<std::size_t>({n_points, n_basis}));
+  std::size_t index = 0;
+  for (unsigned i = 0; i <= this->m_order; ++i) {
+    for (unsigned j = 0; j <= this->m_order; ++j) {
+      for (unsigned k = 0; k <= this->m_order - std::max(i, j); ++k, ++index) {
+        xt::col(output, index) = basis_function(abc, i, j, k);
+      }
+    }
+  }
+  return output;
+}
+
+xt::xarray<double> RefPyramid::grad_vandermonde(const xt::xarray<double> &rst) const {
+  const auto abc = detail::pyramid_rst_to_abc(rst);
+  const std::size_t n_points = rst.shape()[0];
+  const std::size_t n_basis = this->m_np;  // (order+1)(order+2)(2*order+3)/6
+
+  xt::xarray<double> output(xt::dynamic_shape<std::size_t>({n_points, n_basis, 3}));
+  std::size_t index = 0;
+  for (unsigned i = 0; i <= this->m_order; ++i) {
+    for (unsigned j = 0; j <= this->m_order; ++j) {
+      for (unsigned k = 0; k <= this->m_order - std::max(i, j); ++k, ++index) {
+        xt::view(output, xt::all(), index, xt::all()) = grad_basis_function(abc, i, j, k);
+      }
+    }
+  }
+  return output;
+}
+
+xt::xarray<double> RefPyramid::grad_operator(const xt::xarray<double> &v,
+                                             const xt::xarray<double> &gv) const {
+  auto gvr = xt::view(gv, xt::all(), xt::all(), 0);
+  auto gvs = xt::view(gv, xt::all(), xt::all(), 1);
+  auto gvt = xt::view(gv, xt::all(), xt::all(), 2);
+
+  const auto vt = xt::transpose(v);
+  const auto dvt_dr = xt::transpose(gvr);
+  const auto dvt_ds = xt::transpose(gvs);
+  const auto dvt_dt = xt::transpose(gvt);
+
+  const auto dr = xt::transpose(xt::linalg::solve(vt, dvt_dr));
+  const auto ds = xt::transpose(xt::linalg::solve(vt, dvt_ds));
+  const auto dt = xt::transpose(xt::linalg::solve(vt, dvt_dt));
+
+  return xt::stack(xt::xtuple(dr, ds, dt), 2);
+}
+
+}  // namespace oiseau::dg::nodal
+
+namespace oiseau::dg::nodal::detail {
+
+xt::xarray<double> pyramid_rst_to_abc(const xt::xarray<double> &rst) {
+  xt::xarray<double> abc = xt::zeros_like(rst);
+  for (std::size_t n = 0; n < rst.shape()[0]; ++n) {
+    const double t = rst(n, 2);
+    if (t != 1) {
+      abc(n, 0) = 2 * rst(n, 0) / (1 - t);
+      abc(n, 1) = 2 * rst(n, 1) / (1 - t);
+    }
+    abc(n, 2) = t;
+  }
+  return abc;
+}
+
+xt::xarray<double> generate_pyramid_nodes(unsigned order) {
+  const std::size_t n_p = (order + 1) * (order + 2) * (2 * order + 3) / 6;
+  const xt::xarray<double> t1d = utils::jacobi_gl(order, 0.0, 0.0);
+
+  auto shape = xt::xarray<double>::shape_type{n_p, 3};
+  xt::xarray<double> output = xt::zeros<double>(shape);
+  std::size_t n = 0;
+  for (unsigned k = 0; k <= order; ++k) {
+    // Layer k holds an order-(order - k) Gauss-Lobatto grid; the last layer is the apex.
+    const unsigned m = order - k;
+    const double h = 0.5 * (1 - t1d(k));
+    const xt::xarray<double> g = m > 0 ? utils::jacobi_gl(m, 0.0, 0.0) : xt::xarray<double>{0.0};
+    for (unsigned j = 0; j <= m; ++j) {
+      for (unsigned i = 0; i <= m; ++i, ++n) {
+        output(n, 0) = h * g(i);
+        output(n, 1) = h * g(j);
+        output(n, 2) = t1d(k);
+      }
+    }
+  }
+  return output;
+}
+
+}  // namespace oiseau::dg::nodal::detail
@@ -0,0 +1,80 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <xtensor/core/xtensor_forward.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+
+/**
+ * @file ref_pyramid.hpp
+ * @brief Defines the reference square-based pyramid used in nodal Discontinuous Galerkin methods.
+ */
+
+namespace oiseau::dg::nodal {
+
+/**
+ * @class RefPyramid
+ * @brief Reference pyramid with base [-1, 1]^2 at t = -1 and apex at (0, 0, 1).
+ *
+ * Basis functions are defined in the collapsed coordinates
+ * \f$a = 2r/(1-t)\f$, \f$b = 2s/(1-t)\f$, \f$c = t\f$ (with a = b = 0 at the apex) as
+ * \f[
+ *   \phi_{ijk} = 2^{m+1} P_i(a)\,P_j(b) \left(\tfrac{1-c}{2}\right)^m P_k^{(2m+2,0)}(c),
+ *   \quad m = \max(i, j),\ i, j \le N,\ k \le N - m,
+ * \f]
+ * which is orthonormal on the pyramid and spans the (rational) space of Bergot, Cohen and
+ * Duruflé, containing all polynomials of degree N. Nodes are laid out in Gauss-Lobatto layers
+ * along t; layer k holds an (N-k+1)^2 tensor Gauss-Lobatto grid scaled to the cross-section.
+ */
+class RefPyramid : public RefElement {
+ public:
+  explicit RefPyramid(unsigned order);
+
+  /**
+   * @brief Evaluates the orthonormal basis function \f$\phi_{ijk}\f$.
+   *
+   * @param abc 2D array (shape: N_points × 3) of collapsed (a, b, c) coordinates, see
+   *            `detail::pyramid_rst_to_abc`.
+   * @return    1D array (length N_points) of basis function values.
+   */
+  static xt::xarray<double> basis_function(const xt::xarray<double>& abc, int i, int j, int k);
+
+  /**
+   * @brief Computes the gradient of \f$\phi_{ijk}\f$ with respect to (r, s, t).
+   *
+   * @param abc 2D array (shape: N_points × 3) of collapsed (a, b, c) coordinates.
+   * @return    2D array (shape: N_points × 3) containing (∂/∂r, ∂/∂s, ∂/∂t) for each point.
+   */
+  static xt::xarray<double> grad_basis_function(const xt::xarray<double>& abc, int i, int j,
+                                                int k);
+
+ private:
+  xt::xarray<double> vandermonde(const xt::xarray<double>& rst) const;
+  xt::xarray<double> grad_vandermonde(const xt::xarray<double>& rst) const;
+  xt::xarray<double> grad_operator(const xt::xarray<double>& v, const xt::xarray<double>& gv) const;
+};
+
+namespace detail {
+
+/**
+ * @brief Transforms pyramid (r, s, t) coordinates to collapsed (a, b, c) coordinates.
+ *
+ * a = 2r/(1-t), b = 2s/(1-t), c = t; the apex (t = 1) is mapped to a = b = 0.
+ */
+xt::xarray<double> pyramid_rst_to_abc(const xt::xarray<double>& rst);
+
+/**
+ * @brief Generates the nodes of the reference pyramid, layer by layer along t.
+ *
+ * @param order Polynomial order (number of points = (order+1)(order+2)(2 order+3)/6).
+ * @return      2D array (N_points × 3) of (r, s, t) coordinates.
+ */
+xt::xarray<double> generate_pyramid_nodes(unsigned order);
+
+}  // namespace detail
+}  // namespace oiseau::dg::nodal
@@ -6,6 +6,7 @@
 
 #include "oiseau/dg/nodal/ref_quadrilateral.hpp"
 
+#include <array>
 #include <cstddef>
 #include <xtensor-blas/xlinalg.hpp>
 #include <xtensor/core/xshape.hpp>
@@ -28,6 +29,15 @@ RefQuadrilateral::RefQuadrilateral(unsigned order) : RefElement(order) {
   this->m_v = this->vandermonde(this->m_r);
   this->m_gv = this->grad_vandermonde(this->m_r);
   this->m_d = grad_operator(this->m_v, this->m_gv);
+  this->init_mass();
+  const std::array<detail::RefFace, 4> faces = {{
+      {{0.0, 1.0, 0.0}, -1.0, {0}},
+      {{1.0, 0.0, 0.0}, 1.0, {1}},
+      {{0.0, 1.0, 0.0}, 1.0, {0}},
+      {{1.0, 0.0, 0.0}, -1.0, {1}},
+  }};
+  this->init_face_operators(faces, get_ref_element(RefElementType::Line, order).get());
+  this->pack_operators();
 }
 
 xt::xarray<double> RefQuadrilateral::basis_function(const xt::xarray<double> &rs, int i, int j) {
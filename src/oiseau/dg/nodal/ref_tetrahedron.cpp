@@ -7,6 +7,7 @@
 #include "oiseau/dg/nodal/ref_tetrahedron.hpp"
 
 #include <cmath>
+#include <array>
 #include <cstddef>
 #include <numbers>
 #include <xtensor-blas/xlinalg.hpp>
@@ -33,6 +34,15 @@ RefTetrahedron::RefTetrahedron(unsigned order) : RefElement(order) {
   this->m_v = this->vandermonde(this->m_r);
   this->m_gv = this->grad_vandermonde(this->m_r);
   this->m_d = this->grad_operator(this->m_v, this->m_gv);
+  this->init_mass();
+  const std::array<detail::RefFace, 4> faces = {{
+      {{1.0, 1.0, 1.0}, -1.0, {0, 1}},
+      {{1.0, 0.0, 0.0}, -1.0, {1, 2}},
+      {{0.0, 1.0, 0.0}, -1.0, {0, 2}},
+      {{0.0, 0.0, 1.0}, -1.0, {0, 1}},
+  }};
+  this->init_face_operators(faces, get_ref_element(RefElementType::Triangle, order).get());
+  this->pack_operators();
 }
 
 xt::xarray<double> RefTetrahedron::basis_function(const xt::xarray<double> &abc, int i, int j,
@@ -46,18 +56,14 @@ xt::xarray<double> RefTetrahedron::basis_function(const xt::xarray<double> &abc,
   return 2 * std::numbers::sqrt2 * h1 * h2 * xt::pow(1 - b, i) * h3 * xt::pow(1 - c, i + j);
 }
 
-xt::xarray<double> RefTetrahedron::grad_basis_function(const xt::xarray<double> &abc, int i, int j,
-                                                       int k) const {
-  xt::xarray<double> a = xt::col(abc, 0);
-  xt::xarray<double> b = xt::col(abc, 1);
-  xt::xarray<double> c = xt::col(abc, 2);
-  xt::xarray<double> fa = oiseau::utils::jacobi_p(i, 0.0, 0.0, a);
-  xt::xarray<double> dfa = oiseau::utils::grad_jacobi_p(i, 0.0, 0.0, a);
-  xt::xarray<double> gb = oiseau::utils::jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
-  xt::xarray<double> dgb = oiseau::utils::grad_jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
-  xt::xarray<double> hc = oiseau::utils::jacobi_p(k, 2.0 * (i + j) + 2.0, 0.0, c);
-  xt::xarray<double> dhc = oiseau::utils::grad_jacobi_p(k, 2.0 * (i + j) + 2.0, 0.0, c);
+namespace {
 
+/// Gradient of mode (i, j, k) from its Jacobi factors at the collapsed coordinates (a, b, c).
+xt::xarray<double> mode_gradient(const xt::xarray<double> &a, const xt::xarray<double> &b,
+                                 const xt::xarray<double> &c, const xt::xarray<double> &fa,
+                                 const xt::xarray<double> &dfa, const xt::xarray<double> &gb,
+                                 const xt::xarray<double> &dgb, const xt::xarray<double> &hc,
+                                 const xt::xarray<double> &dhc, int i, int j) {
   xt::xarray<double> v3dr, v3ds, v3dt, tmp;
 
   v3dr = dfa * (gb * hc);
@@ -85,37 +91,78 @@ xt::xarray<double> RefTetrahedron::grad_basis_function(const xt::xarray<double>
   return xt::stack(xt::xtuple(v3dr, v3ds, v3dt), 1);
 }
 
+}  // namespace
+
+xt::xarray<double> RefTetrahedron::grad_basis_function(const xt::xarray<double> &abc, int i, int j,
+                                                       int k) const {
+  xt::xarray<double> a = xt::col(abc, 0);
+  xt::xarray<double> b = xt::col(abc, 1);
+  xt::xarray<double> c = xt::col(abc, 2);
+  xt::xarray<double> fa = oiseau::utils::jacobi_p(i, 0.0, 0.0, a);
+  xt::xarray<double> dfa = oiseau::utils::grad_jacobi_p(i, 0.0, 0.0, a);
+  xt::xarray<double> gb = oiseau::utils::jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
+  xt::xarray<double> dgb = oiseau::utils::grad_jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
+  xt::xarray<double> hc = oiseau::utils::jacobi_p(k, 2.0 * (i + j) + 2.0, 0.0, c);
+  xt::xarray<double> dhc = oiseau::utils::grad_jacobi_p(k, 2.0 * (i + j) + 2.0, 0.0, c);
+  return mode_gradient(a, b, c, fa, dfa, gb, dgb, hc, dhc, i, j);
+}
+
 xt::xarray<double> RefTetrahedron::vandermonde(const xt::xarray<double> &rst) const {
   auto abc = detail::rst_to_abc(rst);
+  const xt::xarray<double> a = xt::col(abc, 0);
+  const xt::xarray<double> b = xt::col(abc, 1);
+  const xt::xarray<double> c = xt::col(abc, 2);
   const std::size_t n_points = rst.shape()[0];
   const std::size_t n_basis = this->m_np;  // (order+1)(order+2)*(order+3)/6
   //
   xt::xarray<double> output(xt::dynamic_shape<std::size_t>({n_points, n_basis}));
 
+  // Every degree of each Jacobi factor in one sweep, instead of one call per mode.
+  const auto fa = oiseau::utils::jacobi_p_table(this->m_order, 0.0, 0.0, a);
+  xt::xarray<double> weight_b = 2 * std::numbers::sqrt2 * xt::ones_like(b);  // 2√2 (1 - b)^i
+  xt::xarray<double> weight_c = xt::ones_like(c);                            // (1 - c)^i
   std::size_t index = 0;
   for (unsigned i = 0; i <= this->m_order; ++i) {
+    const auto gb = oiseau::utils::jacobi_p_table(this->m_order - i, 2.0 * i + 1.0, 0.0, b);
+    xt::xarray<double> weight = weight_c;  // (1 - c)^(i + j)
     for (unsigned j = 0; j <= this->m_order - i; ++j) {
-      for (unsigned k = 0; k <= this->m_order - i - j; ++k, ++index) {
-        xt::col(output, index) = this->basis_function(abc, i, j, k);
-      }
+      const unsigned n = this->m_order - i - j;
+      const auto hc = oiseau::utils::jacobi_p_table(n, 2.0 * (i + j) + 2.0, 0.0, c);
+      const xt::xarray<double> fg = xt::row(fa, i) * xt::row(gb, j) * weight_b * weight;
+      for (unsigned k = 0; k <= n; ++k, ++index) xt::col(output, index) = fg * xt::row(hc, k);
+      weight *= 1 - c;
     }
+    weight_b *= 1 - b;
+    weight_c *= 1 - c;
   }
   return output;
 }
 
 xt::xarray<double> RefTetrahedron::grad_vandermonde(const xt::xarray<double> &rst) const {
   auto abc = detail::rst_to_abc(rst);
+  const xt::xarray<double> a = xt::col(abc, 0);
+  const xt::xarray<double> b = xt::col(abc, 1);
+  const xt::xarray<double> c = xt::col(abc, 2);
   const std::size_t n_points = rst.shape()[0];
   const std::size_t n_basis = this->m_np;  // (order+1)(order+2)*(order+3)/6
   //
   xt::xarray<double> output(xt::dynamic_shape<std::size_t>({n_points, n_basis, 3}));
 
+  const auto fa = oiseau::utils::jacobi_p_table(this->m_order, 0.0, 0.0, a);
+  const auto dfa = oiseau::utils::grad_jacobi_p_table(this->m_order, 0.0, 0.0, a);
   std::size_t index = 0;
   for (unsigned i = 0; i <= this->m_order; ++i) {
-    for (unsigned j = 0; j <= this->m_order - i; ++j) {
-      for (unsigned k = 0; k <= this->m_order - i - j; ++k, ++index) {
-        auto tmp = this->grad_basis_function(abc, i, j, k);
-        xt::view(output, xt::all(), index, xt::all()) = tmp;
+    const unsigned nb = this->m_order - i;
+    const auto gb = oiseau::utils::jacobi_p_table(nb, 2.0 * i + 1.0, 0.0, b);
+    const auto dgb = oiseau::utils::grad_jacobi_p_table(nb, 2.0 * i + 1.0, 0.0, b);
+    for (unsigned j = 0; j <= nb; ++j) {
+      const unsigned nc = nb - j;
+      const auto hc = oiseau::utils::jacobi_p_table(nc, 2.0 * (i + j) + 2.0, 0.0, c);
+      const auto dhc = oiseau::utils::grad_jacobi_p_table(nc, 2.0 * (i + j) + 2.0, 0.0, c);
+      for (unsigned k = 0; k <= nc; ++k, ++index) {
+        xt::view(output, xt::all(), index, xt::all()) =
+            mode_gradient(a, b, c, xt::row(fa, i), xt::row(dfa, i), xt::row(gb, j),
+                          xt::row(dgb, j), xt::row(hc, k), xt::row(dhc, k), i, j);
       }
     }
   }
@@ -33,6 +33,14 @@ RefTriangle::RefTriangle(unsigned order) : RefElement(order) {
   this->m_v = this->vandermonde(this->m_r);
   this->m_gv = this->grad_vandermonde(this->m_r);
   this->m_d = this->grad_operator(this->m_v, this->m_gv);
+  this->init_mass();
+  const std::array<detail::RefFace, 3> faces = {{
+      {{1.0, 1.0, 0.0}, 0.0, {0}},
+      {{1.0, 0.0, 0.0}, -1.0, {1}},
+      {{0.0, 1.0, 0.0}, -1.0, {0}},
+  }};
+  this->init_face_operators(faces, get_ref_element(RefElementType::Line, order).get());
+  this->pack_operators();
 }
 
 xt::xarray<double> RefTriangle::basis_function(const xt::xarray<double> &ab, int i, int j) {
@@ -43,15 +51,13 @@ xt::xarray<double> RefTriangle::basis_function(const xt::xarray<double> &ab, int
   return std::numbers::sqrt2 * h1 * h2 * xt::pow(1 - b, i);
 }
 
-xt::xarray<double> RefTriangle::grad_basis_function(const xt::xarray<double> &ab, int i, int j) {
-  xt::xarray<double> a = xt::col(ab, 0);
-  xt::xarray<double> b = xt::col(ab, 1);
-
-  xt::xarray<double> fa = oiseau::utils::jacobi_p(i, 0.0, 0.0, a);
-  xt::xarray<double> dfa = oiseau::utils::grad_jacobi_p(i, 0.0, 0.0, a);
-  xt::xarray<double> gb = oiseau::utils::jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
-  xt::xarray<double> dgb = oiseau::utils::grad_jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
+namespace {
 
+/// Gradient of mode (i, j) from its Jacobi factors at the collapsed coordinates (a, b).
+xt::xarray<double> mode_gradient(const xt::xarray<double> &a, const xt::xarray<double> &b,
+                                 const xt::xarray<double> &fa, const xt::xarray<double> &dfa,
+                                 const xt::xarray<double> &gb, const xt::xarray<double> &dgb,
+                                 int i) {
   xt::xarray<double> dmodedr = dfa * gb;
   xt::xarray<double> dmodeds = dfa * (gb * (0.5 * (1 + a)));
 
@@ -70,25 +76,47 @@ xt::xarray<double> RefTriangle::grad_basis_function(const xt::xarray<double> &ab
   return xt::stack(xt::xtuple(dmodedr, dmodeds), 1);
 }
 
+}  // namespace
+
+xt::xarray<double> RefTriangle::grad_basis_function(const xt::xarray<double> &ab, int i, int j) {
+  xt::xarray<double> a = xt::col(ab, 0);
+  xt::xarray<double> b = xt::col(ab, 1);
+
+  xt::xarray<double> fa = oiseau::utils::jacobi_p(i, 0.0, 0.0, a);
+  xt::xarray<double> dfa = oiseau::utils::grad_jacobi_p(i, 0.0, 0.0, a);
+  xt::xarray<double> gb = oiseau::utils::jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
+  xt::xarray<double> dgb = oiseau::utils::grad_jacobi_p(j, 2.0 * i + 1.0, 0.0, b);
+  return mode_gradient(a, b, fa, dfa, gb, dgb, i);
+}
+
 xt::xarray<double> RefTriangle::vandermonde(const xt::xarray<double> &rs) const {
   const auto ab = detail::rs_to_ab(rs);
+  const xt::xarray<double> a = xt::col(ab, 0);
+  const xt::xarray<double> b = xt::col(ab, 1);
 
   const std::size_t n_points = rs.shape()[0];
   const std::size_t n_basis = this->m_np;  // (order+1)(order+2)/2
 
   xt::xarray<double> output = xt::zeros<double>({n_points, n_basis});
 
+  // Every degree of each Jacobi factor in one sweep, instead of one call per mode.
+  const auto fa = oiseau::utils::jacobi_p_table(this->m_order, 0.0, 0.0, a);
+  xt::xarray<double> weight = std::numbers::sqrt2 * xt::ones_like(b);  // sqrt(2) (1 - b)^i
   std::size_t index = 0;
   for (unsigned i = 0; i <= this->m_order; ++i) {
+    const auto gb = oiseau::utils::jacobi_p_table(this->m_order - i, 2.0 * i + 1.0, 0.0, b);
     for (unsigned j = 0; j <= this->m_order - i; ++j, ++index) {
-      xt::col(output, index) = this->basis_function(ab, i, j);
+      xt::col(output, index) = xt::row(fa, i) * xt::row(gb, j) * weight;
     }
+    weight *= 1 - b;
   }
   return output;
 }
 
 xt::xarray<double> RefTriangle::grad_vandermonde(const xt::xarray<double> &rs) const {
   const auto ab = detail::rs_to_ab(rs);
+  const xt::xarray<double> a = xt::col(ab, 0);
+  const xt::xarray<double> b = xt::col(ab, 1);
 
   const std::size_t n_points = rs.shape()[0];
   const std::size_t n_basis = this->m_np;  // (order+1)(order+2)/2
@@ -96,11 +124,16 @@ xt::xarray<double> RefTriangle::grad_vandermonde(const xt::xarray<double> &rs) c
 
   xt::xarray<double> output = xt::zeros<double>({n_points, n_basis, dimensions});
 
+  const auto fa = oiseau::utils::jacobi_p_table(this->m_order, 0.0, 0.0, a);
+  const auto dfa = oiseau::utils::grad_jacobi_p_table(this->m_order, 0.0, 0.0, a);
   std::size_t index = 0;
   for (unsigned i = 0; i <= this->m_order; ++i) {
-    for (unsigned j = 0; j <= this->m_order - i; ++j, ++index) {
-      auto tmp = this->grad_basis_function(ab, i, j);
-      xt::view(output, xt::all(), index, xt::all()) = tmp;
+    const unsigned n = this->m_order - i;
+    const auto gb = oiseau::utils::jacobi_p_table(n, 2.0 * i + 1.0, 0.0, b);
+    const auto dgb = oiseau::utils::grad_jacobi_p_table(n, 2.0 * i + 1.0, 0.0, b);
+    for (unsigned j = 0; j <= n; ++j, ++index) {
+      xt::view(output, xt::all(), index, xt::all()) =
+          mode_gradient(a, b, xt::row(fa, i), xt::row(dfa, i), xt::row(gb, j), xt::row(dgb, j), i);
     }
   }
   return output;
@@ -0,0 +1,136 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nodal/sum_factorization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/utils/aligned_matrix.hpp"
+
+namespace oiseau::dg::nodal {
+
+namespace {
+
+/// Distance below which a node coordinate matches a 1D node.
+constexpr double node_tolerance = 1e-10;
+
+/**
+ * `out[p, i, q] = Σ_l a[i, l] u[p, l, q]` for a tensor of shape `pre × n × post`; the inner
+ * loop runs over the contiguous `post` values.
+ */
+void apply_along_axis(const utils::AlignedMatrix& a, std::size_t pre, std::size_t post,
+                      const double* __restrict u, double* __restrict out) {
+  const std::size_t n = a.rows();
+  for (std::size_t p = 0; p < pre; ++p) {
+    const double* up = u + p * n * post;
+    double* op = out + p * n * post;
+    for (std::size_t i = 0; i < n; ++i) {
+      double* oi = op + i * post;
+      for (std::size_t q = 0; q < post; ++q) oi[q] = 0.0;
+      for (std::size_t l = 0; l < n; ++l) {
+        const double ail = a(i, l);
+        const double* ul = up + l * post;
+        for (std::size_t q = 0; q < post; ++q) oi[q] += ail * ul[q];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TensorOperators::TensorOperators(RefElementType type, unsigned order) {
+  if (type == RefElementType::Quadrilateral) {
+    m_dim = 2;
+  } else if (type == RefElementType::Hexahedron) {
+    m_dim = 3;
+  } else {
+    throw std::invalid_argument("TensorOperators: not a tensor-product element");
+  }
+  const auto line = get_ref_element(RefElementType::Line, order);
+  const auto element = get_ref_element(type, order);
+  m_n1 = line->number_of_nodes();
+  m_np = element->number_of_nodes();
+  m_d = utils::AlignedMatrix::from(line->d());
+  m_mass = utils::AlignedMatrix::from(line->mass());
+  m_inv_mass = utils::AlignedMatrix::from(line->inv_mass());
+
+  // Locate every node of the element on the tensor grid of the line nodes.
+  const auto& r1 = line->r();
+  const auto& r = element->r();
+  m_node_of.assign(m_np, m_np);
+  for (std::size_t node = 0; node < m_np; ++node) {
+    std::size_t position = 0;
+    for (std::size_t axis = 0; axis < m_dim; ++axis) {
+      std::size_t l = 0;
+      while (l < m_n1 && std::abs(r(node, axis) - r1(l)) > node_tolerance) ++l;
+      if (l == m_n1) throw std::runtime_error("TensorOperators: node off the tensor grid");
+      position = position * m_n1 + l;
+    }
+    if (m_node_of[position] != m_np) {
+      throw std::runtime_error("TensorOperators: nodes do not form a tensor grid");
+    }
+    m_node_of[position] = node;
+  }
+  bool identity = true;
+  for (std::size_t q = 0; q < m_np; ++q) identity = identity && m_node_of[q] == q;
+  if (identity) m_node_of.clear();
+}
+
+void TensorOperators::d(std::size_t axis, std::span<const double> u,
+                        std::span<double> out) const {
+  if (axis >= m_dim) throw std::invalid_argument("TensorOperators: invalid derivative axis");
+  apply(m_d, 1u << axis, u, out);
+}
+
+void TensorOperators::mass(std::span<const double> u, std::span<double> out) const {
+  apply(m_mass, (1u << m_dim) - 1, u, out);
+}
+
+void TensorOperators::inv_mass(std::span<const double> u, std::span<double> out) const {
+  apply(m_inv_mass, (1u << m_dim) - 1, u, out);
+}
+
+void TensorOperators::apply(const utils::AlignedMatrix& a, unsigned axes,
+                            std::span<const double> u, std::span<double> out) const {
+  if (u.size() % m_np != 0 || out.size() != u.size()) {
+    throw std::invalid_argument("TensorOperators: nodal values do not match the element");
+  }
+  std::vector<double> front(m_np);
+  std::vector<double> back(m_np);
+  for (std::size_t e = 0; e < u.size() / m_np; ++e) {
+    const double* ue = u.data() + e * m_np;
+    double* oute = out.data() + e * m_np;
+    if (m_node_of.empty()) {
+      std::copy(ue, ue + m_np, front.begin());
+    } else {
+      for (std::size_t q = 0; q < m_np; ++q) front[q] = ue[m_node_of[q]];
+    }
+    std::size_t pre = 1;
+    std::size_t post = m_np / m_n1;
+    for (std::size_t axis = 0; axis < m_dim; ++axis) {
+      if ((axes >> axis) & 1u) {
+        apply_along_axis(a, pre, post, front.data(), back.data());
+        std::swap(front, back);
+      }
+      pre *= m_n1;
+      post /= m_n1;
+    }
+    if (m_node_of.empty()) {
+      std::copy(front.begin(), front.end(), oute);
+    } else {
+      for (std::size_t q = 0; q < m_np; ++q) oute[m_node_of[q]] = front[q];
+    }
+  }
+}
+
+}  // namespace oiseau::dg::nodal
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/utils/aligned_matrix.hpp"
+
+namespace oiseau::dg::nodal {
+
+/**
+ * @class TensorOperators
+ * @brief Sum-factorized reference operators of quadrilaterals and hexahedra.
+ *
+ * The nodes of tensor-product elements are the products of the Gauss–Lobatto nodes of
+ * `RefLine`, so their derivative, mass and inverse mass matrices are Kronecker products of
+ * the 1D ones. Applying the 1D operators along each axis costs O(p^(d+1)) per element instead
+ * of the O(p^(2d)) of the dense `RefElement` matrices, and stores O(p²) values.
+ *
+ * Nodal values are stored element by element, in the node order of the reference element;
+ * a size that is not a multiple of `number_of_nodes()` throws `std::invalid_argument`.
+ */
+class TensorOperators {
+ public:
+  /// Throws `std::invalid_argument` unless `type` is a quadrilateral or a hexahedron.
+  TensorOperators(RefElementType type, unsigned order);
+
+  inline unsigned dimension() const { return m_dim; }
+  inline std::size_t number_of_nodes() const { return m_np; }
+
+  /// Derivative along reference axis `axis`.
+  void d(std::size_t axis, std::span<const double> u, std::span<double> out) const;
+  void mass(std::span<const double> u, std::span<double> out) const;
+  void inv_mass(std::span<const double> u, std::span<double> out) const;
+
+ private:
+  /// Applies `a` along the axes set in `axes` (bit `i` for axis `i`) to every element.
+  void apply(const utils::AlignedMatrix& a, unsigned axes, std::span<const double> u,
+             std::span<double> out) const;
+
+  unsigned m_dim;
+  std::size_t m_n1;  ///< Nodes per axis.
+  std::size_t m_np;
+  utils::AlignedMatrix m_d;
+  utils::AlignedMatrix m_mass;
+  utils::AlignedMatrix m_inv_mass;
+  /// Node of each tensor position (axis 0 slowest); empty if they coincide.
+  std::vector<std::size_t> m_node_of;
+};
+
+}  // namespace oiseau::dg::nodal
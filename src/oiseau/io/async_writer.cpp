@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/async_writer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+#include "oiseau/io/xdmf.hpp"
+
+namespace oiseau::io {
+
+AsyncSnapshotWriter::AsyncSnapshotWriter(Sink sink, const AsyncWriterOptions& options)
+    : m_sink(std::move(sink)), m_slots(std::max<std::size_t>(options.num_buffers, 1)) {
+  for (std::size_t i = m_slots.size(); i-- > 0;) m_free.push_back(i);
+  const std::size_t n_threads = std::max<std::size_t>(options.num_threads, 1);
+  m_writers.reserve(n_threads);
+  for (std::size_t i = 0; i < n_threads; ++i) {
+    m_writers.emplace_back([this](std::stop_token stop) { run(stop); });
+  }
+}
+
+AsyncSnapshotWriter::~AsyncSnapshotWriter() {
+  {
+    std::unique_lock lock(m_mutex);
+    m_slot_freed.wait(lock, [&] { return m_in_flight == 0; });
+  }
+  for (auto& writer : m_writers) writer.request_stop();
+  m_writers.clear();
+}
+
+void AsyncSnapshotWriter::submit(double time, std::span<const XDMFField> fields) {
+  const std::size_t index = acquire();
+  // The slot is ours until it is queued; assigning into its fields reuses their capacity.
+  Slot& slot = m_slots[index];
+  slot.time = time;
+  slot.fields.resize(fields.size());
+  for (std::size_t f = 0; f < fields.size(); ++f) {
+    SnapshotField& field = slot.fields[f];
+    field.name = fields[f].name;
+    field.values.assign(fields[f].values.begin(), fields[f].values.end());
+    field.components = fields[f].components;
+    field.center = fields[f].center;
+  }
+  enqueue(index);
+}
+
+void AsyncSnapshotWriter::submit_swap(double time, std::vector<SnapshotField>& fields) {
+  const std::size_t index = acquire();
+  m_slots[index].time = time;
+  m_slots[index].fields.swap(fields);
+  enqueue(index);
+}
+
+void AsyncSnapshotWriter::flush() {
+  std::unique_lock lock(m_mutex);
+  m_slot_freed.wait(lock, [&] { return m_in_flight == 0; });
+  rethrow_error();
+}
+
+std::size_t AsyncSnapshotWriter::acquire() {
+  std::unique_lock lock(m_mutex);
+  rethrow_error();
+  m_slot_freed.wait(lock, [&] { return !m_free.empty(); });
+  const std::size_t index = m_free.back();
+  m_free.pop_back();
+  return index;
+}
+
+void AsyncSnapshotWriter::enqueue(std::size_t index) {
+  Slot& slot = m_slots[index];
+  slot.views.clear();
+  for (const auto& field : slot.fields) {
+    slot.views.push_back({field.name, field.values, field.components, field.center});
+  }
+  {
+    std::lock_guard lock(m_mutex);
+    m_ready.push_back(index);
+    ++m_in_flight;
+  }
+  m_slot_ready.notify_one();
+}
+
+void AsyncSnapshotWriter::rethrow_error() {
+  if (m_error) std::rethrow_exception(std::exchange(m_error, nullptr));
+}
+
+void AsyncSnapshotWriter::run(std::stop_token stop) {
+  while (true) {
+    std::size_t index;
+    {
+      std::unique_lock lock(m_mutex);
+      if (!m_slot_ready.wait(lock, stop, [&] { return !m_ready.empty(); })) return;
+      index = m_ready.front();
+      m_ready.pop_front();
+    }
+    const Slot& slot = m_slots[index];
+    std::exception_ptr error;
+    try {
+      m_sink(slot.time, slot.views);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    {
+      std::lock_guard lock(m_mutex);
+      if (error && !m_error) m_error = error;
+      m_free.push_back(index);
+      --m_in_flight;
+    }
+    m_slot_freed.notify_all();
+  }
+}
+
+}  // namespace oiseau::io
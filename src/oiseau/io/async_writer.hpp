@@ -0,0 +1,107 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "oiseau/io/xdmf.hpp"
+
+/**
+ * @file async_writer.hpp
+ * @brief Background output of snapshots through a bounded pool of staging buffers.
+ */
+
+namespace oiseau::io {
+
+/// A field owned by a staging slot, handed back to the caller by `submit_swap`.
+struct SnapshotField {
+  std::string name;
+  std::vector<double> values;
+  unsigned components = 1;
+  XDMFCenter center = XDMFCenter::Node;
+};
+
+/// Settings of `AsyncSnapshotWriter`.
+struct AsyncWriterOptions {
+  std::size_t num_buffers = 2;  ///< Staging slots; two give classic double buffering.
+  std::size_t num_threads = 1;  ///< Writer threads; only a single one keeps snapshots in order.
+};
+
+/**
+ * @class AsyncSnapshotWriter
+ * @brief Hands snapshots to a sink on dedicated writer threads while the caller keeps going.
+ *
+ * `submit` copies the fields into a free staging slot (or `submit_swap` exchanges buffers with
+ * it) and returns as soon as the slot is queued, so output overlaps with the computation of the
+ * next steps. When every slot is in flight, `submit` blocks until a writer frees one; this
+ * back-pressure bounds the memory spent on staging. The writers are separate threads rather
+ * than tasks of `utils::default_thread_pool`, so blocking I/O never starves compute kernels.
+ *
+ * The first exception thrown by the sink is rethrown by the next `submit` or `flush`. The
+ * destructor flushes every queued snapshot before joining the writers; errors that surface
+ * only then are dropped, so call `flush` explicitly to observe them.
+ */
+class AsyncSnapshotWriter {
+ public:
+  /// Called on a writer thread for each snapshot; must be thread-safe if `num_threads > 1`.
+  using Sink = std::function<void(double time, std::span<const XDMFField> fields)>;
+
+  explicit AsyncSnapshotWriter(Sink sink, const AsyncWriterOptions& options = {});
+  AsyncSnapshotWriter(const AsyncSnapshotWriter&) = delete;
+  AsyncSnapshotWriter& operator=(const AsyncSnapshotWriter&) = delete;
+  ~AsyncSnapshotWriter();
+
+  /// Queues a copy of `fields`, blocking while no staging slot is free.
+  void submit(double time, std::span<const XDMFField> fields);
+
+  /**
+   * @brief Queues `fields` without copying their values.
+   *
+   * The vector is swapped with the storage of the staging slot, so on return it holds
+   * recycled fields of an earlier snapshot, whose buffers can be refilled without allocating.
+   */
+  void submit_swap(double time, std::vector<SnapshotField>& fields);
+
+  /// Blocks until every queued snapshot has been written.
+  void flush();
+
+ private:
+  struct Slot {
+    double time = 0;
+    std::vector<SnapshotField> fields;
+    std::vector<XDMFField> views;
+  };
+
+  std::size_t acquire();
+  void enqueue(std::size_t slot);
+  void rethrow_error();
+  void run(std::stop_token stop);
+
+  Sink m_sink;
+  std::vector<Slot> m_slots;
+  std::vector<std::size_t> m_free;
+  std::deque<std::size_t> m_ready;
+  std::size_t m_in_flight = 0;  ///< Slots queued or being written.
+  std::exception_ptr m_error;
+  std::mutex m_mutex;
+  std::condition_variable_any m_slot_freed;
+  std::condition_variable_any m_slot_ready;
+
+  std::vector<std::jthread> m_writers;  // declared last: stopped before the slots go away
+};
+
+}  // namespace oiseau::io
@@ -0,0 +1,247 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/checkpoint.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "oiseau/io/mapped_file.hpp"
+#include "oiseau/utils/thread_pool.hpp"
+
+namespace oiseau::io::detail {
+
+namespace {
+
+constexpr char checkpoint_magic[8] = {'O', 'I', 'S', 'E', 'A', 'U', 'C', 'P'};
+/// Version 2 added signed sections and the cell attributes and facets of the mesh.
+constexpr std::uint32_t checkpoint_version = 2;
+constexpr std::uint32_t byte_order_mark = 0x01020304;
+constexpr std::uint64_t section_alignment = 64;
+/// Pieces larger than this are split so that a single big array is still copied in parallel.
+constexpr std::size_t copy_chunk = std::size_t{1} << 22;
+
+struct FileHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint64_t file_size;
+  std::uint64_t n_sections;
+  double time;
+  std::uint8_t reserved[24];
+};
+static_assert(sizeof(FileHeader) == 64);
+
+struct SectionEntry {
+  char name[64];  ///< NUL-terminated.
+  std::uint64_t offset;
+  std::uint64_t count;
+  std::uint32_t type;
+  std::uint32_t components;
+  std::uint64_t reserved;
+};
+static_assert(sizeof(SectionEntry) == 96);
+
+constexpr std::uint64_t align_up(std::uint64_t offset) {
+  return (offset + section_alignment - 1) / section_alignment * section_alignment;
+}
+
+bool valid_type(std::uint32_t type) {
+  return type >= static_cast<std::uint32_t>(SectionType::U8) &&
+         type <= static_cast<std::uint32_t>(SectionType::I32);
+}
+
+struct CopyTask {
+  const std::byte* source;
+  std::byte* target;
+  std::size_t bytes;
+};
+
+/// Owns the descriptor and the shared mapping of the file being written.
+struct OutputMapping {
+  int fd = -1;
+  void* data = MAP_FAILED;
+  std::size_t size = 0;
+
+  ~OutputMapping() {
+    if (data != MAP_FAILED) ::munmap(data, size);
+    if (fd >= 0) ::close(fd);
+  }
+};
+
+}  // namespace
+
+std::size_t section_type_size(SectionType type) {
+  switch (type) {
+  case SectionType::U8:
+    return 1;
+  case SectionType::U32:
+  case SectionType::I32:
+    return 4;
+  case SectionType::U64:
+  case SectionType::F64:
+    return 8;
+  }
+  throw std::invalid_argument("Unknown checkpoint section type");
+}
+
+void write_checkpoint(const std::filesystem::path& path, double time,
+                      std::span<const CheckpointSection> sections) {
+  FileHeader header{};
+  std::memcpy(header.magic, checkpoint_magic, sizeof(checkpoint_magic));
+  header.version = checkpoint_version;
+  header.byte_order = byte_order_mark;
+  header.n_sections = sections.size();
+  header.time = time;
+
+  // The whole layout is known up front, so every piece can be copied to its place independently.
+  std::vector<SectionEntry> table(sections.size());
+  std::set<std::string_view> names;
+  std::uint64_t offset = align_up(sizeof(FileHeader) + table.size() * sizeof(SectionEntry));
+  for (std::size_t s = 0; s < sections.size(); ++s) {
+    const CheckpointSection& section = sections[s];
+    if (section.name.empty() || section.name.size() >= sizeof(SectionEntry::name) ||
+        !names.insert(section.name).second) {
+      throw std::invalid_argument("Invalid or duplicate checkpoint section name: " + section.name);
+    }
+    std::uint64_t bytes = 0;
+    for (const auto& piece : section.pieces) bytes += piece.size();
+    const std::size_t value_size = section_type_size(section.type);
+    if (bytes % value_size != 0) {
+      throw std::invalid_argument("Checkpoint section " + section.name +
+                                  " does not hold whole values");
+    }
+    SectionEntry& entry = table[s];
+    std::memcpy(entry.name, section.name.data(), section.name.size());
+    entry.offset = offset;
+    entry.count = bytes / value_size;
+    entry.type = static_cast<std::uint32_t>(section.type);
+    entry.components = section.components;
+    offset = align_up(offset + bytes);
+  }
+  header.file_size = offset;
+
+  std::filesystem::path temporary = path;
+  temporary += ".tmp";
+  try {
+    OutputMapping out;
+    out.fd = ::open(temporary.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (out.fd < 0) {
+      throw std::runtime_error("Could not open file for writing: " + temporary.string());
+    }
+    // Reserving the blocks first turns a full disk into an error here rather than a SIGBUS
+    // while the mapping is written back.
+    out.size = static_cast<std::size_t>(header.file_size);
+    if (::posix_fallocate(out.fd, 0, static_cast<off_t>(out.size)) != 0) {
+      throw std::runtime_error("Could not allocate checkpoint file: " + temporary.string());
+    }
+    out.data = ::mmap(nullptr, out.size, PROT_READ | PROT_WRITE, MAP_SHARED, out.fd, 0);
+    if (out.data == MAP_FAILED) {
+      throw std::runtime_error("Could not map checkpoint file: " + temporary.string());
+    }
+    auto* base = static_cast<std::byte*>(out.data);
+    std::memcpy(base, &header, sizeof(header));
+    std::memcpy(base + sizeof(header), table.data(), table.size() * sizeof(SectionEntry));
+
+    std::vector<CopyTask> tasks;
+    for (std::size_t s = 0; s < sections.size(); ++s) {
+      std::byte* target = base + table[s].offset;
+      for (const auto& piece : sections[s].pieces) {
+        for (std::size_t first = 0; first < piece.size(); first += copy_chunk) {
+          const std::size_t bytes = std::min(copy_chunk, piece.size() - first);
+          tasks.push_back({piece.data() + first, target, bytes});
+          target += bytes;
+        }
+      }
+    }
+    utils::parallel_for(
+        tasks.size(),
+        [&](std::size_t t) { std::memcpy(tasks[t].target, tasks[t].source, tasks[t].bytes); },
+        64);
+
+    if (::msync(out.data, out.size, MS_SYNC) != 0 || ::fsync(out.fd) != 0) {
+      throw std::runtime_error("Could not flush checkpoint file: " + temporary.string());
+    }
+  } catch (...) {
+    std::error_code ignored;
+    std::filesystem::remove(temporary, ignored);
+    throw;
+  }
+  std::filesystem::rename(temporary, path);
+}
+
+CheckpointFile::CheckpointFile(const std::filesystem::path& path) : m_file(path) {
+  const std::string_view view = m_file.view();
+  const auto fail = [&](const std::string& reason) {
+    throw std::runtime_error("Invalid checkpoint " + path.string() + ": " + reason);
+  };
+
+  FileHeader header{};
+  if (view.size() < sizeof(header)) fail("file too small");
+  std::memcpy(&header, view.data(), sizeof(header));
+  if (std::memcmp(header.magic, checkpoint_magic, sizeof(checkpoint_magic)) != 0) {
+    fail("not an oiseau checkpoint");
+  }
+  if (header.byte_order != byte_order_mark) fail("written with a different byte order");
+  if (header.version == 0 || header.version > checkpoint_version) {
+    fail("unsupported format version " + std::to_string(header.version));
+  }
+  if (header.file_size != view.size()) fail("truncated");
+  if (header.n_sections > (view.size() - sizeof(header)) / sizeof(SectionEntry)) {
+    fail("section table out of bounds");
+  }
+  m_time = header.time;
+  m_version = header.version;
+
+  const auto* base = reinterpret_cast<const std::byte*>(view.data());
+  m_sections.reserve(header.n_sections);
+  for (std::uint64_t s = 0; s < header.n_sections; ++s) {
+    SectionEntry entry{};
+    std::memcpy(&entry, base + sizeof(header) + s * sizeof(SectionEntry), sizeof(entry));
+    const std::size_t name_size = ::strnlen(entry.name, sizeof(entry.name));
+    if (name_size == sizeof(entry.name)) fail("unterminated section name");
+    std::string name(entry.name, name_size);
+    if (!valid_type(entry.type)) fail("unknown type of section " + name);
+    const auto type = static_cast<SectionType>(entry.type);
+    if (entry.offset % section_alignment != 0 || entry.offset > view.size() ||
+        entry.count > (view.size() - entry.offset) / section_type_size(type)) {
+      fail("section " + name + " out of bounds");
+    }
+    m_sections.push_back({std::move(name), type, entry.components, entry.count,
+                          base + entry.offset});
+  }
+}
+
+const SectionView* CheckpointFile::find(std::string_view name) const {
+  const auto it = std::ranges::find(m_sections, name, &SectionView::name);
+  return it == m_sections.end() ? nullptr : &*it;
+}
+
+const SectionView& CheckpointFile::require(std::string_view name, SectionType type) const {
+  const SectionView* section = find(name);
+  if (section == nullptr) {
+    throw std::runtime_error("Checkpoint has no section " + std::string(name));
+  }
+  if (section->type != type) {
+    throw std::runtime_error("Checkpoint section " + std::string(name) + " has the wrong type");
+  }
+  return *section;
+}
+
+}  // namespace oiseau::io::detail
@@ -0,0 +1,181 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "oiseau/io/mapped_file.hpp"
+
+/**
+ * @file checkpoint.hpp
+ * @brief Checkpoint and restart of a DG space and the fields defined on it.
+ *
+ * A checkpoint is a single binary file: a 64-byte header (magic, format version, byte-order
+ * mark, time), a table of named sections and the section payloads, each starting on a 64-byte
+ * boundary. Payloads are raw native-endian arrays, so a restart maps the file and reads the
+ * mesh, the element nodes and the fields in place instead of parsing or recomputing them.
+ * The mesh keeps its cell entity and physical tags and its facets across a restart.
+ */
+
+namespace oiseau::mesh {
+class Mesh;
+}  // namespace oiseau::mesh
+
+namespace oiseau::dg {
+class DGSpace;
+}  // namespace oiseau::dg
+
+namespace oiseau::io {
+
+namespace detail {
+class CheckpointFile;
+}  // namespace detail
+
+/// A nodal field on a `DGSpace`, element by element, `components` values per node.
+struct CheckpointField {
+  std::string name;
+  std::span<const double> values;
+  unsigned components = 1;
+};
+
+/**
+ * @brief Writes `space`, its mesh and `fields` at `time` to the checkpoint `path`.
+ *
+ * The file is first written next to `path` and renamed over it once complete, so a failure
+ * while writing never destroys the previous checkpoint. Sections are copied concurrently.
+ * Throws `std::invalid_argument` if a field does not match the space.
+ */
+void checkpoint_write(const std::filesystem::path& path, const oiseau::dg::DGSpace& space,
+                      std::span<const CheckpointField> fields = {}, double time = 0.0);
+
+/**
+ * @class Checkpoint
+ * @brief A checkpoint mapped for restart.
+ *
+ * The mesh and the `DGSpace` are rebuilt from the stored element nodes without interpolating
+ * the geometry again; the fields are views into the mapping and stay valid while the
+ * checkpoint lives.
+ */
+class Checkpoint {
+ public:
+  /// Maps and validates `path`; throws `std::runtime_error` if it is not a usable checkpoint.
+  explicit Checkpoint(const std::filesystem::path& path);
+  Checkpoint(Checkpoint&&) noexcept;
+  Checkpoint& operator=(Checkpoint&&) noexcept;
+  ~Checkpoint();
+
+  double time() const;
+  inline const oiseau::mesh::Mesh& mesh() const { return *m_mesh; }
+  inline const oiseau::dg::DGSpace& space() const { return *m_space; }
+
+  /// All stored fields, in the order they were written.
+  std::vector<CheckpointField> fields() const;
+  /// The field called `name`; throws `std::invalid_argument` if there is none.
+  CheckpointField field(std::string_view name) const;
+
+ private:
+  std::unique_ptr<detail::CheckpointFile> m_file;
+  std::unique_ptr<oiseau::mesh::Mesh> m_mesh;
+  std::unique_ptr<oiseau::dg::DGSpace> m_space;
+};
+
+}  // namespace oiseau::io
+
+namespace oiseau::io::detail {
+
+/// Value type of a checkpoint section; the numbers are part of the file format.
+enum class SectionType : std::uint32_t { U8 = 1, U32 = 2, U64 = 3, F64 = 4, I32 = 5 };
+
+/// Size in bytes of one value of `type`.
+std::size_t section_type_size(SectionType type);
+
+template <class T>
+constexpr SectionType section_type_of() {
+  if constexpr (std::is_same_v<T, double>) {
+    return SectionType::F64;
+  } else if constexpr (std::is_same_v<T, std::int32_t>) {
+    return SectionType::I32;
+  } else {
+    static_assert(std::is_unsigned_v<T> && (sizeof(T) == 1 || sizeof(T) == 4 || sizeof(T) == 8),
+                  "Checkpoint sections hold doubles, 32-bit signed integers or unsigned "
+                  "integers of 8, 32 or 64 bits");
+    if constexpr (sizeof(T) == 1) return SectionType::U8;
+    if constexpr (sizeof(T) == 4) return SectionType::U32;
+    if constexpr (sizeof(T) == 8) return SectionType::U64;
+  }
+}
+
+/// A section to be written; its payload is the concatenation of `pieces`.
+struct CheckpointSection {
+  std::string name;  ///< At most 63 bytes, unique within the file.
+  SectionType type;
+  std::uint32_t components = 1;  ///< Values per entity, recorded for the reader.
+  std::vector<std::span<const std::byte>> pieces;
+};
+
+template <class T>
+CheckpointSection make_section(std::string name, std::span<const T> values,
+                               std::uint32_t components = 1) {
+  return {std::move(name), section_type_of<T>(), components, {std::as_bytes(values)}};
+}
+
+/// Writes a checkpoint file made of `sections`, copying their pieces concurrently.
+void write_checkpoint(const std::filesystem::path& path, double time,
+                      std::span<const CheckpointSection> sections);
+
+/// A section of a mapped checkpoint.
+struct SectionView {
+  std::string name;
+  SectionType type;
+  std::uint32_t components;
+  std::uint64_t count;  ///< Number of values, components included.
+  const std::byte* data;
+};
+
+/**
+ * @class CheckpointFile
+ * @brief Read-only view of the sections of a checkpoint file.
+ */
+class CheckpointFile {
+ public:
+  /// Maps `path` and validates its header and section table.
+  explicit CheckpointFile(const std::filesystem::path& path);
+
+  inline double time() const { return m_time; }
+  inline std::uint32_t version() const { return m_version; }
+  inline std::span<const SectionView> sections() const { return m_sections; }
+
+  /// The section called `name`, or `nullptr`.
+  const SectionView* find(std::string_view name) const;
+
+  /// The values of section `name`; throws `std::runtime_error` if it is missing or not a `T`.
+  template <class T>
+  std::span<const T> get(std::string_view name) const {
+    const SectionView& section = require(name, section_type_of<T>());
+    return {reinterpret_cast<const T*>(section.data), section.count};
+  }
+
+  /// The section `name`; throws `std::runtime_error` if it is missing or not of `type`.
+  const SectionView& require(std::string_view name, SectionType type) const;
+
+ private:
+  MappedFile m_file;
+  double m_time = 0;
+  std::uint32_t m_version = 0;
+  std::vector<SectionView> m_sections;
+};
+
+}  // namespace oiseau::io::detail
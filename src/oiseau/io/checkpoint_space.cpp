@@ -0,0 +1,217 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/io/checkpoint.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
+namespace oiseau::io {
+
+namespace {
+
+// Section names. Cell kinds are stored as their `CellKind` value. Cell attributes and facets
+// appear from format version 2 on, and only when the mesh has them.
+constexpr std::string_view mesh_x = "mesh/x";
+constexpr std::string_view mesh_cell_kinds = "mesh/cell_kinds";
+constexpr std::string_view mesh_conn_offsets = "mesh/conn/offsets";
+constexpr std::string_view mesh_conn = "mesh/conn";
+constexpr std::string_view mesh_high_order_offsets = "mesh/high_order/offsets";
+constexpr std::string_view mesh_high_order = "mesh/high_order";
+constexpr std::string_view mesh_entity_tags = "mesh/entity_tags";
+constexpr std::string_view mesh_physical_tags = "mesh/physical_tags";
+constexpr std::string_view facet_kinds = "mesh/facets/cell_kinds";
+constexpr std::string_view facet_conn_offsets = "mesh/facets/conn/offsets";
+constexpr std::string_view facet_conn = "mesh/facets/conn";
+constexpr std::string_view facet_physical_tags = "mesh/facets/physical_tags";
+constexpr std::string_view dg_orders = "dg/orders";
+constexpr std::string_view dg_nodes = "dg/nodes";
+constexpr std::string_view field_prefix = "field/";
+
+template <class T>
+std::vector<T> to_vector(std::span<const T> values) {
+  return {values.begin(), values.end()};
+}
+
+std::vector<std::uint8_t> cell_kinds(std::span<const oiseau::mesh::CellType> cell_types) {
+  std::vector<std::uint8_t> kinds(cell_types.size());
+  for (std::size_t i = 0; i < cell_types.size(); ++i) {
+    kinds[i] = static_cast<std::uint8_t>(cell_types[i]->kind());
+  }
+  return kinds;
+}
+
+std::vector<oiseau::mesh::CellType> read_cell_types(const detail::CheckpointFile& file,
+                                                    std::string_view name) {
+  const auto kinds = file.get<std::uint8_t>(name);
+  std::vector<oiseau::mesh::CellType> cell_types(kinds.size());
+  for (std::size_t i = 0; i < kinds.size(); ++i) {
+    if (kinds[i] == 0 || kinds[i] > static_cast<std::uint8_t>(oiseau::mesh::CellKind::Pyramid)) {
+      throw std::runtime_error("Checkpoint holds an unknown cell kind");
+    }
+    cell_types[i] = oiseau::mesh::get_cell_type(static_cast<oiseau::mesh::CellKind>(kinds[i]));
+  }
+  return cell_types;
+}
+
+/// The values of the optional section `name`, empty when the file does not hold it.
+std::vector<std::int32_t> read_optional_tags(const detail::CheckpointFile& file,
+                                             std::string_view name) {
+  return file.find(name) == nullptr ? std::vector<std::int32_t>{}
+                                    : to_vector(file.get<std::int32_t>(name));
+}
+
+utils::JaggedArray<std::size_t> read_jagged(const detail::CheckpointFile& file,
+                                            std::string_view offsets, std::string_view data) {
+  const auto row_offsets = file.get<std::uint64_t>(offsets);
+  const auto values = file.get<std::uint64_t>(data);
+  return {std::vector<std::size_t>(values.begin(), values.end()),
+          std::vector<std::size_t>(row_offsets.begin(), row_offsets.end())};
+}
+
+}  // namespace
+
+void checkpoint_write(const std::filesystem::path& path, const oiseau::dg::DGSpace& space,
+                      std::span<const CheckpointField> fields, double time) {
+  using detail::make_section;
+  const auto& topology = space.mesh().topology();
+  const auto& geometry = space.mesh().geometry();
+  const auto cell_types = topology.cell_types();
+  const auto elements = space.elements();
+
+  const std::vector<std::uint8_t> kinds = cell_kinds(cell_types);
+  const auto& facets = topology.facets();
+  const std::vector<std::uint8_t> kinds_of_facets = cell_kinds(facets.cell_types);
+
+  std::vector<detail::CheckpointSection> sections;
+  sections.push_back(make_section(std::string(mesh_x), geometry.x(), geometry.dim()));
+  sections.push_back(make_section<std::uint8_t>(std::string(mesh_cell_kinds), kinds));
+  sections.push_back(make_section(std::string(mesh_conn_offsets), topology.conn().row_offsets()));
+  sections.push_back(make_section(std::string(mesh_conn), topology.conn().data()));
+  if (!topology.entity_tags().empty()) {
+    sections.push_back(make_section(std::string(mesh_entity_tags), topology.entity_tags()));
+  }
+  if (!topology.physical_tags().empty()) {
+    sections.push_back(make_section(std::string(mesh_physical_tags), topology.physical_tags()));
+  }
+  if (facets.size() > 0) {
+    sections.push_back(make_section<std::uint8_t>(std::string(facet_kinds), kinds_of_facets));
+    sections.push_back(make_section(std::string(facet_conn_offsets), facets.conn.row_offsets()));
+    sections.push_back(make_section(std::string(facet_conn), facets.conn.data()));
+    sections.push_back(make_section<std::int32_t>(std::string(facet_physical_tags),
+                                                  facets.physical_tags));
+  }
+  const auto& high_order_nodes = geometry.high_order_nodes();
+  if (high_order_nodes.num_rows() > 0) {
+    sections.push_back(
+        make_section(std::string(mesh_high_order_offsets), high_order_nodes.row_offsets()));
+    sections.push_back(make_section(std::string(mesh_high_order), high_order_nodes.data()));
+  }
+  sections.push_back(make_section(std::string(dg_orders), space.orders()));
+
+  // Element nodes are the expensive part of the space; each element is one piece of a section.
+  detail::CheckpointSection nodes{std::string(dg_nodes), detail::SectionType::F64,
+                                  geometry.dim(), {}};
+  std::size_t n_nodes = 0;
+  nodes.pieces.reserve(elements.size());
+  for (const auto& element : elements) {
+    const auto& x = element.nodes();
+    nodes.components = static_cast<std::uint32_t>(x.shape()[1]);
+    nodes.pieces.push_back(std::as_bytes(std::span<const double>(x.data(), x.size())));
+    n_nodes += x.shape()[0];
+  }
+  sections.push_back(std::move(nodes));
+
+  for (const auto& field : fields) {
+    if (field.components == 0 || field.values.size() != n_nodes * field.components) {
+      throw std::invalid_argument("checkpoint_write: field '" + field.name +
+                                  "' does not match the DG space");
+    }
+    sections.push_back(
+        make_section(std::string(field_prefix) + field.name, field.values, field.components));
+  }
+  detail::write_checkpoint(path, time, sections);
+}
+
+Checkpoint::Checkpoint(const std::filesystem::path& path)
+    : m_file(std::make_unique<detail::CheckpointFile>(path)) {
+  const detail::CheckpointFile& file = *m_file;
+
+  const detail::SectionView& x = file.require(mesh_x, detail::SectionType::F64);
+  oiseau::mesh::FacetTable facets;
+  if (file.find(facet_kinds) != nullptr) {
+    facets = {read_jagged(file, facet_conn_offsets, facet_conn),
+              read_cell_types(file, facet_kinds),
+              to_vector(file.get<std::int32_t>(facet_physical_tags))};
+    if (facets.conn.num_rows() != facets.size() || facets.physical_tags.size() != facets.size()) {
+      throw std::runtime_error("Checkpoint facet sections do not match");
+    }
+  }
+  oiseau::mesh::Topology topology(read_jagged(file, mesh_conn_offsets, mesh_conn),
+                                  read_cell_types(file, mesh_cell_kinds), std::move(facets));
+  try {
+    topology.set_cell_attributes(read_optional_tags(file, mesh_entity_tags),
+                                 read_optional_tags(file, mesh_physical_tags));
+  } catch (const std::invalid_argument&) {
+    throw std::runtime_error("Checkpoint cell attributes do not match the cells");
+  }
+  std::vector<double> coordinates = to_vector(file.get<double>(mesh_x));
+  oiseau::mesh::Geometry geometry =
+      file.find(mesh_high_order) == nullptr
+          ? oiseau::mesh::Geometry(std::move(coordinates), x.components)
+          : oiseau::mesh::Geometry(std::move(coordinates), x.components,
+                                   read_jagged(file, mesh_high_order_offsets, mesh_high_order));
+  m_mesh = std::make_unique<oiseau::mesh::Mesh>(std::move(topology), std::move(geometry));
+
+  const auto orders = file.get<std::uint32_t>(dg_orders);
+  const detail::SectionView& nodes = file.require(dg_nodes, detail::SectionType::F64);
+  m_space = std::make_unique<oiseau::dg::DGSpace>(
+      *m_mesh, std::vector<unsigned>(orders.begin(), orders.end()), file.get<double>(dg_nodes),
+      nodes.components);
+}
+
+Checkpoint::Checkpoint(Checkpoint&&) noexcept = default;
+Checkpoint& Checkpoint::operator=(Checkpoint&&) noexcept = default;
+Checkpoint::~Checkpoint() = default;
+
+double Checkpoint::time() const { return m_file->time(); }
+
+std::vector<CheckpointField> Checkpoint::fields() const {
+  std::vector<CheckpointField> fields;
+  for (const auto& section : m_file->sections()) {
+    if (section.name.starts_with(field_prefix) && section.type == detail::SectionType::F64) {
+      fields.push_back({section.name.substr(field_prefix.size()),
+                        {reinterpret_cast<const double*>(section.data), section.count},
+                        section.components});
+    }
+  }
+  return fields;
+}
+
+CheckpointField Checkpoint::field(std::string_view name) const {
+  const detail::SectionView* section = m_file->find(std::string(field_prefix) + std::string(name));
+  if (section == nullptr || section->type != detail::SectionType::F64) {
+    throw std::invalid_argument("Checkpoint has no field named " + std::string(name));
+  }
+  return {std::string(name), {reinterpret_cast<const double*>(section->data), section->count},
+          section->components};
+}
+
+}  // namespace oiseau::io
@@ -0,0 +1,234 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/compressed_stream.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "oiseau/io/mapped_file.hpp"
+
+#ifdef OISEAU_HAS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef OISEAU_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace oiseau::io::detail {
+
+class StreamDecoder {
+ public:
+  virtual ~StreamDecoder() = default;
+  /// Writes up to `size` decompressed bytes to `out`; returns 0 once the input is exhausted.
+  virtual std::size_t decode(char* out, std::size_t size) = 0;
+  /// Decompressed size recorded by the container, or 0 if unknown.
+  virtual std::size_t size_hint() const { return 0; }
+};
+
+namespace {
+
+#ifdef OISEAU_HAS_ZLIB
+class GzipDecoder final : public StreamDecoder {
+ public:
+  explicit GzipDecoder(std::string_view input) : m_input(input) {
+    // 15 + 32: largest window, with automatic gzip/zlib header detection.
+    if (inflateInit2(&m_stream, 15 + 32) != Z_OK) {
+      throw std::runtime_error("Could not initialize the gzip decoder");
+    }
+  }
+  ~GzipDecoder() override { inflateEnd(&m_stream); }
+
+  std::size_t decode(char* out, std::size_t size) override {
+    // zlib counts bytes in `uInt`, so large requests are served in slices.
+    constexpr std::size_t max_slice = std::size_t{1} << 30;
+    std::size_t produced = 0;
+    while (produced < size && !m_finished) {
+      if (m_stream.avail_in == 0 && m_offset < m_input.size()) {
+        const std::size_t n = std::min(m_input.size() - m_offset, max_slice);
+        m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(m_input.data() + m_offset));
+        m_stream.avail_in = static_cast<uInt>(n);
+        m_offset += n;
+      }
+      const std::size_t n_out = std::min(size - produced, max_slice);
+      m_stream.next_out = reinterpret_cast<Bytef*>(out + produced);
+      m_stream.avail_out = static_cast<uInt>(n_out);
+      const int status = inflate(&m_stream, Z_NO_FLUSH);
+      produced += n_out - m_stream.avail_out;
+      const bool input_exhausted = m_stream.avail_in == 0 && m_offset == m_input.size();
+      if (status == Z_STREAM_END) {
+        // Concatenated members (as written by pigz or `cat a.gz b.gz`) form a single stream.
+        if (input_exhausted) {
+          m_finished = true;
+        } else {
+          inflateReset(&m_stream);
+        }
+      } else if (status == Z_BUF_ERROR && input_exhausted) {
+        throw std::runtime_error("Invalid gzip stream: unexpected end of data");
+      } else if (status != Z_OK && status != Z_BUF_ERROR) {
+        throw std::runtime_error(std::string("Invalid gzip stream: ") +
+                                 (m_stream.msg ? m_stream.msg : "corrupted data"));
+      }
+    }
+    return produced;
+  }
+
+  std::size_t size_hint() const override {
+    // ISIZE, the last four bytes of a member, is the uncompressed size modulo 2^32. It is only
+    // trusted up to deflate's maximum ratio of about 1032:1, which guards against damaged files.
+    if (m_input.size() < 18) return 0;
+    const auto* tail = reinterpret_cast<const unsigned char*>(m_input.data() + m_input.size() - 4);
+    const std::size_t isize =
+        static_cast<std::size_t>(tail[0]) | static_cast<std::size_t>(tail[1]) << 8 |
+        static_cast<std::size_t>(tail[2]) << 16 | static_cast<std::size_t>(tail[3]) << 24;
+    return std::min(isize, 1032 * m_input.size());
+  }
+
+ private:
+  std::string_view m_input;
+  std::size_t m_offset = 0;
+  z_stream m_stream{};
+  bool m_finished = false;
+};
+#endif
+
+#ifdef OISEAU_HAS_ZSTD
+class ZstdDecoder final : public StreamDecoder {
+ public:
+  explicit ZstdDecoder(std::string_view input)
+      : m_stream(ZSTD_createDStream()), m_input{input.data(), input.size(), 0} {
+    if (!m_stream || ZSTD_isError(ZSTD_initDStream(m_stream))) {
+      ZSTD_freeDStream(m_stream);
+      throw std::runtime_error("Could not initialize the zstd decoder");
+    }
+  }
+  ~ZstdDecoder() override { ZSTD_freeDStream(m_stream); }
+
+  std::size_t decode(char* out, std::size_t size) override {
+    ZSTD_outBuffer output{out, size, 0};
+    while (output.pos < output.size) {
+      // Successive frames are decoded back to back, like concatenated gzip members.
+      const std::size_t status = ZSTD_decompressStream(m_stream, &output, &m_input);
+      if (ZSTD_isError(status)) {
+        throw std::runtime_error(std::string("Invalid zstd stream: ") +
+                                 ZSTD_getErrorName(status));
+      }
+      if (m_input.pos == m_input.size && output.pos < output.size) {
+        // With room left in `output` everything decodable has been flushed.
+        if (status != 0) throw std::runtime_error("Invalid zstd stream: unexpected end of data");
+        break;
+      }
+    }
+    return output.pos;
+  }
+
+  std::size_t size_hint() const override {
+    const auto size = ZSTD_getFrameContentSize(m_input.src, m_input.size);
+    if (size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR) return 0;
+    return static_cast<std::size_t>(size);
+  }
+
+ private:
+  ZSTD_DStream* m_stream;
+  ZSTD_inBuffer m_input;
+};
+#endif
+
+std::unique_ptr<StreamDecoder> make_decoder(std::string_view input, Compression compression) {
+  switch (compression) {
+  case Compression::Gzip:
+#ifdef OISEAU_HAS_ZLIB
+    return std::make_unique<GzipDecoder>(input);
+#else
+    throw std::runtime_error("Cannot read gzip-compressed input: oiseau was built without zlib");
+#endif
+  case Compression::Zstd:
+#ifdef OISEAU_HAS_ZSTD
+    return std::make_unique<ZstdDecoder>(input);
+#else
+    throw std::runtime_error("Cannot read zstd-compressed input: oiseau was built without zstd");
+#endif
+  case Compression::None:
+    break;
+  }
+  throw std::invalid_argument("DecompressingStreambuf requires a compressed input");
+}
+
+}  // namespace
+
+Compression detect_compression(std::string_view head) {
+  if (head.starts_with("\x1f\x8b")) return Compression::Gzip;
+  if (head.starts_with("\x28\xb5\x2f\xfd")) return Compression::Zstd;
+  return Compression::None;
+}
+
+DecompressingStreambuf::DecompressingStreambuf(MappedFile file, Compression compression,
+                                               std::size_t chunk_size, std::size_t num_chunks)
+    : m_file(std::move(file)),
+      m_decoder(make_decoder(m_file.view(), compression)),
+      m_size_hint(m_decoder->size_hint()),
+      m_chunk_size(std::max<std::size_t>(chunk_size, 1)),
+      m_ring(m_chunk_size * std::max<std::size_t>(num_chunks, 1)),
+      m_lengths(std::max<std::size_t>(num_chunks, 1)),
+      m_producer([this](std::stop_token stop) { produce(std::move(stop)); }) {}
+
+DecompressingStreambuf::~DecompressingStreambuf() = default;
+
+void DecompressingStreambuf::produce(std::stop_token stop) {
+  const std::size_t n_chunks = m_lengths.size();
+  try {
+    for (std::size_t chunk = 0;; ++chunk) {
+      {
+        std::unique_lock lock(m_mutex);
+        if (!m_cv.wait(lock, stop, [&] { return chunk - m_read < n_chunks; })) return;
+      }
+      // The reader only touches chunks in [m_read, m_written), so this one is ours to fill.
+      char* out = m_ring.data() + (chunk % n_chunks) * m_chunk_size;
+      const std::size_t length = m_decoder->decode(out, m_chunk_size);
+      if (length == 0) break;
+      std::lock_guard lock(m_mutex);
+      m_lengths[chunk % n_chunks] = length;
+      ++m_written;
+      m_cv.notify_all();
+    }
+  } catch (...) {
+    std::lock_guard lock(m_mutex);
+    m_error = std::current_exception();
+  }
+  std::lock_guard lock(m_mutex);
+  m_finished = true;
+  m_cv.notify_all();
+}
+
+DecompressingStreambuf::int_type DecompressingStreambuf::underflow() {
+  std::unique_lock lock(m_mutex);
+  if (m_reading) {
+    ++m_read;
+    m_reading = false;
+    m_cv.notify_all();
+  }
+  m_cv.wait(lock, [&] { return m_written > m_read || m_finished; });
+  if (m_written == m_read) {
+    if (m_error) std::rethrow_exception(m_error);
+    return traits_type::eof();
+  }
+  const std::size_t slot = m_read % m_lengths.size();
+  char* begin = m_ring.data() + slot * m_chunk_size;
+  setg(begin, begin, begin + m_lengths[slot]);
+  m_reading = true;
+  return traits_type::to_int_type(*gptr());
+}
+
+}  // namespace oiseau::io::detail
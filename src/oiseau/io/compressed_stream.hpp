@@ -0,0 +1,92 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <streambuf>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "oiseau/io/mapped_file.hpp"
+
+/**
+ * @file compressed_stream.hpp
+ * @brief Streaming decompression of gzip and zstd files.
+ *
+ * Codecs are optional: gzip needs the library to be built with zlib (`OISEAU_HAS_ZLIB`) and
+ * zstd with libzstd (`OISEAU_HAS_ZSTD`). Compressed files are still recognised without them,
+ * so that reading one fails with a clear message instead of a parse error.
+ */
+
+namespace oiseau::io::detail {
+
+/// Container format of a file, as told by its leading magic bytes.
+enum class Compression { None, Gzip, Zstd };
+
+/// Returns the compression of a file whose first bytes are `head`.
+Compression detect_compression(std::string_view head);
+
+/// Incremental decoder of one compressed input; defined next to each codec.
+class StreamDecoder;
+
+/**
+ * @class DecompressingStreambuf
+ * @brief Input stream buffer that decompresses a mapped file on a background thread.
+ *
+ * A producer thread decodes the file into a ring of `num_chunks` buffers of `chunk_size` bytes
+ * while `underflow` hands filled buffers to the reader in order, so decompression overlaps with
+ * whatever the reader does with the bytes and nothing is written to disk. Decoding errors are
+ * rethrown from `underflow` once the chunks decoded before them have been read; wrap the buffer
+ * in a stream with `exceptions(std::ios::badbit)` to see them.
+ */
+class DecompressingStreambuf : public std::streambuf {
+ public:
+  static constexpr std::size_t default_chunk_size = std::size_t{1} << 20;
+  static constexpr std::size_t default_num_chunks = 4;
+
+  /// Starts decoding `file`; throws `std::runtime_error` if the codec is not available.
+  DecompressingStreambuf(MappedFile file, Compression compression,
+                         std::size_t chunk_size = default_chunk_size,
+                         std::size_t num_chunks = default_num_chunks);
+  DecompressingStreambuf(const DecompressingStreambuf&) = delete;
+  DecompressingStreambuf& operator=(const DecompressingStreambuf&) = delete;
+  ~DecompressingStreambuf() override;
+
+  /// Decompressed size recorded by the container, or 0 when it does not record one.
+  inline std::size_t size_hint() const { return m_size_hint; }
+
+ protected:
+  int_type underflow() override;
+
+ private:
+  void produce(std::stop_token stop);
+
+  MappedFile m_file;
+  std::unique_ptr<StreamDecoder> m_decoder;
+  std::size_t m_size_hint = 0;
+
+  std::size_t m_chunk_size;
+  std::vector<char> m_ring;
+  std::vector<std::size_t> m_lengths;
+  std::size_t m_written = 0;  ///< Chunks filled by the producer so far.
+  std::size_t m_read = 0;     ///< Chunks released by the reader so far.
+  bool m_reading = false;     ///< Whether the reader currently holds chunk `m_read`.
+  bool m_finished = false;
+  std::exception_ptr m_error;
+  std::mutex m_mutex;
+  std::condition_variable_any m_cv;
+
+  std::jthread m_producer;  // declared last: joined before the ring is destroyed
+};
+
+}  // namespace oiseau::io::detail
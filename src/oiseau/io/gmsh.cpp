@@ -6,86 +6,1190 @@
 
 #include "oiseau/io/gmsh.hpp"
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
+#include <functional>
 #include <fstream>
 #include <istream>
+#include <limits>
+#include <map>
+#include <set>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "oiseau/io/compressed_stream.hpp"
 #include "oiseau/io/gmsh_file.hpp"
+#include "oiseau/io/gmsh_index.hpp"
+#include "oiseau/io/mapped_file.hpp"
 #include "oiseau/mesh/cell.hpp"
 #include "oiseau/mesh/geometry.hpp"
 #include "oiseau/mesh/mesh.hpp"
 #include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+#include "oiseau/utils/thread_pool.hpp"
 
 namespace oiseau::io {
 
 namespace detail {
+namespace {
+struct GMSHElementType {
+  std::size_t type;
+  oiseau::mesh::CellKind kind;
+  unsigned order;
+};
+
+constexpr GMSHElementType gmsh_element_types[] = {
+    {15, oiseau::mesh::CellKind::Point, 1},          {1, oiseau::mesh::CellKind::Interval, 1},
+    {8, oiseau::mesh::CellKind::Interval, 2},        {26, oiseau::mesh::CellKind::Interval, 3},
+    {27, oiseau::mesh::CellKind::Interval, 4},       {28, oiseau::mesh::CellKind::Interval, 5},
+    {2, oiseau::mesh::CellKind::Triangle, 1},        {9, oiseau::mesh::CellKind::Triangle, 2},
+    {21, oiseau::mesh::CellKind::Triangle, 3},       {23, oiseau::mesh::CellKind::Triangle, 4},
+    {25, oiseau::mesh::CellKind::Triangle, 5},       {3, oiseau::mesh::CellKind::Quadrilateral, 1},
+    {10, oiseau::mesh::CellKind::Quadrilateral, 2},  {36, oiseau::mesh::CellKind::Quadrilateral, 3},
+    {37, oiseau::mesh::CellKind::Quadrilateral, 4},  {38, oiseau::mesh::CellKind::Quadrilateral, 5},
+    {4, oiseau::mesh::CellKind::Tetrahedron, 1},     {11, oiseau::mesh::CellKind::Tetrahedron, 2},
+    {5, oiseau::mesh::CellKind::Hexahedron, 1},      {12, oiseau::mesh::CellKind::Hexahedron, 2},
+    {6, oiseau::mesh::CellKind::Prism, 1},           {7, oiseau::mesh::CellKind::Pyramid, 1},
+};
+
+const GMSHElementType &find_gmsh_element_type(std::size_t s) {
+  auto it = std::ranges::find(gmsh_element_types, s, &GMSHElementType::type);
+  if (it == std::ranges::end(gmsh_element_types)) {
+    throw std::runtime_error("Unknown Gmsh cell type: " + std::to_string(s));
+  }
+  return *it;
+}
+
+bool contains(std::span<const std::pair<int, int>> list, int dim, int tag) {
+  return std::ranges::find(list, std::pair{dim, tag}) != list.end();
+}
+
+using EntityPhysicalTags = std::map<std::pair<int, int>, std::vector<int>>;
+
+/// Physical tags of every entity of the body of an MSH 4.1 `$Entities` section.
+EntityPhysicalTags entity_physical_tags(std::istream &stream, bool is_binary) {
+  EntityPhysicalTags tags;
+  EntitiesSection section = entities_handler(stream, is_binary);
+  for (int d = 0; d < 4; ++d) {
+    for (auto &entity : section.blocks[d]) {
+      tags.emplace(std::pair{d, static_cast<int>(entity.tag)}, std::move(entity.physical_tags));
+    }
+  }
+  return tags;
+}
+
+/// Physical tags of every entity of an MSH 4.1 `$Entities` section, keyed by (dim, tag).
+EntityPhysicalTags entity_physical_tags(std::string_view content, const FileIndex &index) {
+  const SectionIndex *entities = index.find("Entities");
+  if (!entities) return {};
+  std::istringstream stream(std::string(entities->body(content)));
+  return entity_physical_tags(stream, index.format.is_binary);
+}
+
+/// Physical tags of the elements of `block`.
+std::span<const int> block_physical_tags(const BlockIndex &block,
+                                         const EntityPhysicalTags &entity_tags) {
+  if (block.legacy) return {&block.physical_tag, block.physical_tag != 0 ? 1u : 0u};
+  const auto it = entity_tags.find({block.entity_dim, block.entity_tag});
+  return it == entity_tags.end() ? std::span<const int>{} : std::span<const int>(it->second);
+}
+
+/// Whether `options` selects the element block `block`.
+bool is_selected(const BlockIndex &block, const GMSHReadOptions &options,
+                 const EntityPhysicalTags &entity_tags) {
+  const int dim = block.entity_dim;
+  if (!options.dimensions.empty() &&
+      std::ranges::find(options.dimensions, dim) == options.dimensions.end()) {
+    return false;
+  }
+  if (!options.entities.empty() && !contains(options.entities, dim, block.entity_tag)) {
+    return false;
+  }
+  return options.physical_groups.empty() ||
+         std::ranges::any_of(block_physical_tags(block, entity_tags), [&](int physical) {
+           return contains(options.physical_groups, dim, physical);
+         });
+}
+
+/// The element blocks of `elements` selected by `options`, in file order.
+std::vector<const BlockIndex *> select_blocks(const SectionIndex &elements,
+                                               const GMSHReadOptions &options,
+                                               const EntityPhysicalTags &entity_tags) {
+  std::vector<const BlockIndex *> selected;
+  for (const auto &block : elements.blocks) {
+    if (is_selected(block, options, entity_tags)) selected.push_back(&block);
+  }
+  return selected;
+}
+
+/// First physical group of the elements of `block`, or 0.
+std::int32_t first_physical_tag(const BlockIndex &block, const EntityPhysicalTags &entity_tags) {
+  const auto physical = block_physical_tags(block, entity_tags);
+  return physical.empty() ? 0 : physical.front();
+}
+
+/// What reading a single partition needs from `$PartitionedEntities` and `$GhostElements`.
+struct PartitionLayout {
+  std::map<std::pair<int, int>, std::vector<int>> entity_partitions;  ///< Keyed by (dim, tag).
+  std::vector<std::pair<int, int>> ghost_entities;                    ///< (dim, tag).
+  std::unordered_map<std::size_t, int> ghost_owners;  ///< Owner of every ghost, by element tag.
+  /// Entities (dim, tag) of the partitions owning a ghost, the only ones that may hold one.
+  std::set<std::pair<int, int>> ghost_sources;
+
+  inline bool in(const BlockIndex &block, int partition) const {
+    const auto it = entity_partitions.find({block.entity_dim, block.entity_tag});
+    return it != entity_partitions.end() &&
+           std::ranges::find(it->second, partition) != it->second.end();
+  }
+  inline bool is_ghost_entity(const BlockIndex &block) const {
+    return contains(ghost_entities, block.entity_dim, block.entity_tag);
+  }
+  inline bool may_hold_ghosts(const BlockIndex &block) const {
+    return ghost_sources.contains({block.entity_dim, block.entity_tag});
+  }
+};
+
+/**
+ * Reads the layout of partition `partition` and adds the physical tags of the partitioned
+ * entities to `entity_tags`, so that blocks can be selected by physical group.
+ */
+PartitionLayout partition_layout(std::string_view content, const FileIndex &index, int partition,
+                                 EntityPhysicalTags &entity_tags) {
+  const SectionIndex *entities = index.find("PartitionedEntities");
+  if (!entities) {
+    throw std::runtime_error("Invalid GMSH file: no $PartitionedEntities section");
+  }
+  const bool is_binary = index.format.is_binary;
+  std::istringstream stream(std::string(entities->body(content)));
+  PartitionedEntitiesSection section = partitioned_entities_handler(stream, is_binary);
+  if (partition < 1 || static_cast<std::size_t>(partition) > section.num_partitions) {
+    throw std::invalid_argument("GMSH file has no partition " + std::to_string(partition));
+  }
+
+  PartitionLayout layout;
+  // Ghost entities are listed by tag only; they hold cells, so they are of the top dimension.
+  int top_dim = 0;
+  for (int d = 0; d < 4; ++d) {
+    if (!section.blocks[d].empty()) top_dim = d;
+    for (auto &entity : section.blocks[d]) {
+      const std::pair key{d, static_cast<int>(entity.tag)};
+      entity_tags.insert_or_assign(key, std::move(entity.physical_tags));
+      layout.entity_partitions.emplace(key, std::move(entity.partitions));
+    }
+  }
+  for (const auto &[tag, ghost_partition] : section.ghost_entities) {
+    layout.ghost_entities.emplace_back(top_dim, tag);
+  }
+
+  if (const SectionIndex *ghosts = index.find("GhostElements")) {
+    std::istringstream ghost_stream(std::string(ghosts->body(content)));
+    for (const auto &ghost : ghost_elements_handler(ghost_stream, is_binary).elements) {
+      if (std::ranges::find(ghost.partitions, partition) != ghost.partitions.end()) {
+        layout.ghost_owners.emplace(ghost.element_tag, ghost.owner);
+      }
+    }
+  }
+  std::set<int> owners;
+  for (const auto &[tag, owner] : layout.ghost_owners) owners.insert(owner);
+  for (const auto &[entity, partitions] : layout.entity_partitions) {
+    if (std::ranges::any_of(partitions, [&](int p) { return owners.contains(p); })) {
+      layout.ghost_sources.insert(entity);
+    }
+  }
+  return layout;
+}
+
+/**
+ * Splits records of `npc` node indices into `nv` vertices and `npc - nv` high-order nodes; the
+ * high-order nodes are dropped when `high_order` is null.
+ */
+void split_cell_nodes(const std::size_t *nodes, std::size_t count, std::size_t npc,
+                      std::size_t nv, std::size_t *vertices, std::size_t *high_order) {
+  for (std::size_t i = 0; i < count; ++i) {
+    std::copy_n(nodes + i * npc, nv, vertices + i * nv);
+    if (high_order) std::copy_n(nodes + i * npc + nv, npc - nv, high_order + i * (npc - nv));
+  }
+}
+
+/**
+ * Reads the vertices of split `split` of an element block, and its high-order nodes when
+ * `high_order` is not null.
+ */
+void read_cell_nodes(std::string_view content, const BlockIndex &block, std::size_t split,
+                     bool is_binary, std::size_t *vertices, std::size_t *high_order) {
+  const std::size_t npc = gmsh_nodes_per_cell(block.type);
+  const std::size_t nv = oiseau::mesh::number_of_nodes(find_gmsh_element_type(block.type).kind, 1);
+  if (npc == nv) {
+    read_element_nodes(content, block, split, is_binary, vertices);
+    return;
+  }
+  const std::size_t n = split_size(block, split);
+  std::vector<std::size_t> cell_nodes(n * npc);
+  read_element_nodes(content, block, split, is_binary, cell_nodes.data());
+  split_cell_nodes(cell_nodes.data(), n, npc, nv, vertices, high_order);
+}
+}  // namespace
+
 oiseau::mesh::CellType gmsh_celltype_to_oiseau_celltype(const std::size_t s) {
-  static const std::unordered_map<std::size_t, oiseau::mesh::CellKind> gmsh_to_kind = {
-      {15, oiseau::mesh::CellKind::Point},      {1, oiseau::mesh::CellKind::Interval},
-      {2, oiseau::mesh::CellKind::Triangle},    {3, oiseau::mesh::CellKind::Quadrilateral},
-      {4, oiseau::mesh::CellKind::Tetrahedron}, {5, oiseau::mesh::CellKind::Hexahedron},
+  return oiseau::mesh::get_cell_type(find_gmsh_element_type(s).kind);
+}
+
+unsigned gmsh_celltype_order(const std::size_t s) { return find_gmsh_element_type(s).order; }
+
+int oiseau_celltype_to_gmsh_celltype(oiseau::mesh::CellType cell_type, unsigned order) {
+  for (const auto &entry : gmsh_element_types) {
+    const bool is_point = entry.kind == oiseau::mesh::CellKind::Point;
+    if (entry.kind == cell_type->kind() && (entry.order == order || is_point)) {
+      return static_cast<int>(entry.type);
+    }
+  }
+  throw std::runtime_error("Cell type has no Gmsh equivalent");
+}
+
+oiseau::mesh::Mesh gmsh_content_to_mesh(
+    std::string_view content, const FileIndex &index, const GMSHReadOptions &options,
+    const std::function<void(std::size_t, std::size_t)> &release) {
+  return gmsh_content_to_partition(content, index, 0, options, release).mesh;
+}
+
+GMSHPartition gmsh_content_to_partition(
+    std::string_view content, const FileIndex &index, int partition,
+    const GMSHReadOptions &options,
+    const std::function<void(std::size_t, std::size_t)> &release) {
+  const bool is_binary = index.format.is_binary;
+  const bool select = !options.selects_all() || partition != 0;
+  const SectionIndex *nodes = index.find("Nodes");
+  const SectionIndex *elements = index.find("Elements");
+  const std::size_t n_file_nodes = nodes ? nodes->header[1] : 0;
+  if (!options.physical_groups.empty() && !index.format.is_legacy() && !index.find("Entities") &&
+      partition == 0) {
+    throw std::runtime_error("Invalid GMSH file: physical groups need an $Entities section");
+  }
+  EntityPhysicalTags entity_tags = entity_physical_tags(content, index);
+  const PartitionLayout layout =
+      partition != 0 ? partition_layout(content, index, partition, entity_tags) : PartitionLayout{};
+
+  // Blocks to read, each with the index of its first node, cell or facet in the mesh. Elements
+  // of the highest dimension read become cells, lower-dimensional ones become facets.
+  std::vector<std::pair<const BlockIndex *, std::size_t>> node_blocks;
+  std::vector<std::pair<const BlockIndex *, std::size_t>> cell_blocks;
+  std::vector<std::pair<const BlockIndex *, std::size_t>> facet_blocks;
+  if (nodes) {
+    for (const auto &block : nodes->blocks) node_blocks.emplace_back(&block, block.first);
+  }
+  std::vector<const BlockIndex *> ghost_blocks;
+  std::size_t n_cells = 0;
+  std::size_t n_facets = 0;
+  if (elements) {
+    auto selected = select_blocks(*elements, options, entity_tags);
+    std::vector<const BlockIndex *> others;
+    if (partition != 0) {
+      // Ghost entities only duplicate cells that `$GhostElements` already assigns.
+      std::erase_if(selected,
+                    [&](const BlockIndex *block) { return layout.is_ghost_entity(*block); });
+      const auto not_owned = std::ranges::stable_partition(
+          selected, [&](const BlockIndex *block) { return layout.in(*block, partition); });
+      others.assign(not_owned.begin(), not_owned.end());
+      selected.erase(not_owned.begin(), not_owned.end());
+    }
+    int tdim = -1;
+    for (const BlockIndex *block : selected) tdim = std::max(tdim, block->entity_dim);
+    for (const BlockIndex *block : selected) {
+      auto &count = block->entity_dim == tdim ? n_cells : n_facets;
+      (block->entity_dim == tdim ? cell_blocks : facet_blocks).emplace_back(block, count);
+      count += block->count;
+    }
+    // Blocks of the other partitions are only scanned when they may hold a ghost cell.
+    for (const BlockIndex *block : others) {
+      if (block->entity_dim == tdim && layout.may_hold_ghosts(*block)) {
+        ghost_blocks.push_back(block);
+      }
+    }
+  }
+
+  // Ghost cells are kept record by record, by element tag; they follow the owned cells.
+  std::vector<std::vector<std::size_t>> ghost_records;
+  std::vector<std::pair<const BlockIndex *, std::size_t>> ghost_jobs;
+  for (const BlockIndex *block : ghost_blocks) {
+    for (std::size_t s = 0; s < number_of_splits(*block); ++s) ghost_jobs.emplace_back(block, s);
+  }
+  ghost_records.resize(ghost_jobs.size());
+  utils::parallel_for(ghost_jobs.size(), [&](std::size_t j) {
+    const auto &[block, split] = ghost_jobs[j];
+    const std::size_t record_size = 1 + gmsh_nodes_per_cell(block->type);
+    std::vector<std::size_t> records(record_size * split_size(*block, split));
+    read_element_records(content, *block, split, is_binary, records.data());
+    for (std::size_t r = 0; r < records.size(); r += record_size) {
+      if (layout.ghost_owners.contains(records[r])) {
+        ghost_records[j].insert(ghost_records[j].end(), records.begin() + r,
+                                records.begin() + r + record_size);
+      }
+    }
+  });
+  const std::size_t n_owned = n_cells;
+  // Calls `f(cell, block, record)` for every ghost cell, in order.
+  auto for_each_ghost = [&](auto &&f) {
+    std::size_t cell = n_owned;
+    for (std::size_t j = 0; j < ghost_jobs.size(); ++j) {
+      const BlockIndex &block = *ghost_jobs[j].first;
+      const std::size_t record_size = 1 + gmsh_nodes_per_cell(block.type);
+      for (std::size_t r = 0; r < ghost_records[j].size(); r += record_size) {
+        f(cell++, block, ghost_records[j].data() + r);
+      }
+    }
   };
-  auto it = gmsh_to_kind.find(s);
-  if (it == gmsh_to_kind.end()) {
-    throw std::runtime_error("Unknown Gmsh cell type: " + std::to_string(s));
+  std::vector<int> ghost_owners;
+  for_each_ghost([&](std::size_t, const BlockIndex &, const std::size_t *record) {
+    ghost_owners.push_back(layout.ghost_owners.at(record[0]));
+  });
+  n_cells += ghost_owners.size();
+
+  std::vector<std::size_t> offsets(n_cells + 1, 0);
+  std::vector<std::size_t> high_order_offsets;
+  std::vector<oiseau::mesh::CellType> cell_types(n_cells);
+  const bool high_order =
+      std::ranges::any_of(cell_blocks,
+                          [](const auto &entry) {
+                            return gmsh_celltype_order(entry.first->type) > 1;
+                          }) ||
+      std::ranges::any_of(ghost_blocks, [](const BlockIndex *block) {
+        return gmsh_celltype_order(block->type) > 1;
+      });
+  if (high_order) high_order_offsets.assign(n_cells + 1, 0);
+  // Cells carry the entity and the first physical group of their block.
+  std::vector<std::int32_t> cell_entity_tags(n_cells);
+  std::vector<std::int32_t> cell_physical_tags(n_cells);
+  auto first_physical = [&](const BlockIndex &block) {
+    return first_physical_tag(block, entity_tags);
+  };
+  for (const auto &[block, first] : cell_blocks) {
+    const auto cell_type = gmsh_celltype_to_oiseau_celltype(block->type);
+    const std::size_t npc = gmsh_nodes_per_cell(block->type);
+    const std::size_t nv = oiseau::mesh::number_of_nodes(cell_type->kind(), 1);
+    std::fill_n(cell_types.begin() + first, block->count, cell_type);
+    std::fill_n(cell_entity_tags.begin() + first, block->count, block->entity_tag);
+    std::fill_n(cell_physical_tags.begin() + first, block->count, first_physical(*block));
+    for (std::size_t i = first; i < first + block->count; ++i) {
+      offsets[i + 1] = offsets[i] + nv;
+      if (high_order) high_order_offsets[i + 1] = high_order_offsets[i] + npc - nv;
+    }
+  }
+  for_each_ghost([&](std::size_t i, const BlockIndex &block, const std::size_t *) {
+    cell_entity_tags[i] = block.entity_tag;
+    cell_physical_tags[i] = first_physical(block);
+    cell_types[i] = gmsh_celltype_to_oiseau_celltype(block.type);
+    const std::size_t npc = gmsh_nodes_per_cell(block.type);
+    const std::size_t nv = oiseau::mesh::number_of_nodes(cell_types[i]->kind(), 1);
+    offsets[i + 1] = offsets[i] + nv;
+    if (high_order) high_order_offsets[i + 1] = high_order_offsets[i] + npc - nv;
+  });
+  std::vector<std::size_t> data(offsets.back());
+  std::vector<std::size_t> high_order_data(high_order_offsets.empty() ? 0
+                                                                      : high_order_offsets.back());
+
+  // Facets keep their vertices only.
+  std::vector<std::size_t> facet_offsets(n_facets + 1, 0);
+  std::vector<oiseau::mesh::CellType> facet_types(n_facets);
+  std::vector<std::int32_t> facet_physical_tags(n_facets, 0);
+  for (const auto &[block, first] : facet_blocks) {
+    const auto cell_type = gmsh_celltype_to_oiseau_celltype(block->type);
+    const std::size_t nv = oiseau::mesh::number_of_nodes(cell_type->kind(), 1);
+    std::fill_n(facet_types.begin() + first, block->count, cell_type);
+    std::fill_n(facet_physical_tags.begin() + first, block->count, first_physical(*block));
+    for (std::size_t i = first; i < first + block->count; ++i) {
+      facet_offsets[i + 1] = facet_offsets[i] + nv;
+    }
+  }
+  std::vector<std::size_t> facet_data(facet_offsets.back());
+
+  // Calls `parse(block, split, first)` concurrently for every split of `blocks`.
+  auto parse_splits = [&](const auto &blocks, auto &&parse) {
+    std::vector<std::pair<std::size_t, std::size_t>> jobs;
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+      for (std::size_t s = 0; s < number_of_splits(*blocks[b].first); ++s) jobs.emplace_back(b, s);
+    }
+    utils::parallel_for(jobs.size(), [&](std::size_t j) {
+      const auto &[block, first] = blocks[jobs[j].first];
+      const std::size_t split = jobs[j].second;
+      parse(*block, split, first + split * records_per_split);
+    });
+  };
+
+  // Node tags are needed to resolve any connectivity; coordinates of a selective read wait
+  // until the referenced nodes are known.
+  std::vector<double> x(select ? 0 : 3 * n_file_nodes);
+  std::vector<std::size_t> node_tags(n_file_nodes);
+  parse_splits(node_blocks, [&](const BlockIndex &block, std::size_t split, std::size_t first) {
+    read_node_tags(content, block, split, is_binary, node_tags.data() + first);
+    if (!select) read_node_coords(content, block, split, is_binary, x.data() + 3 * first);
+  });
+  if (nodes && release && !select) release(nodes->begin, nodes->end);
+  parse_splits(cell_blocks, [&](const BlockIndex &block, std::size_t split, std::size_t first) {
+    read_cell_nodes(content, block, split, is_binary, data.data() + offsets[first],
+                    high_order ? high_order_data.data() + high_order_offsets[first] : nullptr);
+  });
+  parse_splits(facet_blocks, [&](const BlockIndex &block, std::size_t split, std::size_t first) {
+    read_cell_nodes(content, block, split, is_binary, facet_data.data() + facet_offsets[first],
+                    nullptr);
+  });
+  for_each_ghost([&](std::size_t i, const BlockIndex &block, const std::size_t *record) {
+    const std::size_t npc = gmsh_nodes_per_cell(block.type);
+    const std::size_t nv = offsets[i + 1] - offsets[i];
+    for (std::size_t k = 0; k < npc; ++k) {
+      const std::size_t node = record[1 + k] - 1;
+      if (k < nv) {
+        data[offsets[i] + k] = node;
+      } else {
+        high_order_data[high_order_offsets[i] + k - nv] = node;
+      }
+    }
+  });
+  if (elements && release) release(elements->begin, elements->end);
+  if (nodes) {
+    const NodeTagMap tag_map(node_tags, nodes->header[2], nodes->header[3]);
+    tag_map.remap(data);
+    tag_map.remap(high_order_data);
+    tag_map.remap(facet_data);
+  }
+
+  if (select && nodes) {
+    // Renumbers the referenced nodes in file order and reads only the splits holding one.
+    constexpr std::size_t unused = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> renumber(n_file_nodes, unused);
+    for (const auto *conn : {&data, &high_order_data, &facet_data}) {
+      for (const std::size_t node : *conn) renumber[node] = 0;
+    }
+    std::size_t n_used = 0;
+    for (auto &node : renumber) {
+      if (node != unused) node = n_used++;
+    }
+    x.resize(3 * n_used);
+    parse_splits(node_blocks, [&](const BlockIndex &block, std::size_t split, std::size_t first) {
+      const auto used = std::span(renumber).subspan(first, split_size(block, split));
+      if (std::ranges::all_of(used, [](std::size_t node) { return node == unused; })) return;
+      std::vector<double> coords(3 * used.size());
+      read_node_coords(content, block, split, is_binary, coords.data());
+      for (std::size_t r = 0; r < used.size(); ++r) {
+        if (used[r] != unused) std::copy_n(coords.data() + 3 * r, 3, x.data() + 3 * used[r]);
+      }
+    });
+    if (release) release(nodes->begin, nodes->end);
+    for (auto *conn : {&data, &high_order_data, &facet_data}) {
+      utils::parallel_for(
+          conn->size(), [&](std::size_t j) { (*conn)[j] = renumber[(*conn)[j]]; },
+          records_per_split);
+    }
   }
 
-  return oiseau::mesh::get_cell_type(it->second);
+  oiseau::mesh::Geometry geometry =
+      high_order_offsets.empty()
+          ? oiseau::mesh::Geometry(std::move(x), 3)
+          : oiseau::mesh::Geometry(std::move(x), 3,
+                                   utils::JaggedArray<std::size_t>(std::move(high_order_data),
+                                                                   std::move(high_order_offsets)));
+  oiseau::mesh::FacetTable facets{
+      utils::JaggedArray<std::size_t>(std::move(facet_data), std::move(facet_offsets)),
+      std::move(facet_types), std::move(facet_physical_tags)};
+  oiseau::mesh::Topology topology(
+      utils::JaggedArray<std::size_t>(std::move(data), std::move(offsets)), std::move(cell_types),
+      std::move(facets));
+  topology.set_cell_attributes(std::move(cell_entity_tags), std::move(cell_physical_tags));
+  return {oiseau::mesh::Mesh(std::move(topology), std::move(geometry)), n_owned,
+          std::move(ghost_owners)};
+}
+
+namespace {
+/// Appends the next `size` bytes of `in` to `out`.
+void read_bytes(std::istream &in, std::size_t size, std::string &out) {
+  const std::size_t old_size = out.size();
+  out.resize(old_size + size);
+  in.read(out.data() + old_size, static_cast<std::streamsize>(size));
+  if (static_cast<std::size_t>(in.gcount()) != size) {
+    throw std::runtime_error("Invalid GMSH file: truncated");
+  }
+}
+
+/// Appends the next `count` lines of `in`, with their line feeds, to `out`.
+void read_lines(std::istream &in, std::size_t count, std::string &out) {
+  std::string line;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!std::getline(in, line)) throw std::runtime_error("Invalid GMSH file: truncated");
+    out.append(line).push_back('\n');
+  }
+}
+
+/// Skips `count` records of `record_size` bytes, or `count` lines of an ASCII file.
+void skip_records(std::istream &in, std::size_t count, std::size_t record_size, bool is_binary) {
+  if (is_binary) {
+    in.ignore(static_cast<std::streamsize>(count * record_size));
+    if (static_cast<std::size_t>(in.gcount()) != count * record_size) {
+      throw std::runtime_error("Invalid GMSH file: truncated");
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    if (in.peek() == std::istream::traits_type::eof()) {
+      throw std::runtime_error("Invalid GMSH file: truncated");
+    }
+    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+}
+
+template <class T>
+T read_value(std::istream &in) {
+  T value;
+  if (!in.read(reinterpret_cast<char *>(&value), sizeof(T))) {
+    throw std::runtime_error("Invalid GMSH file: truncated");
+  }
+  return value;
+}
+
+/// The next non-blank line of `in`, as a stream of whitespace-separated values.
+std::istringstream header_line(std::istream &in) {
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.find_first_not_of(" \t\r") != std::string::npos) return std::istringstream(line);
+  }
+  throw std::runtime_error("Invalid GMSH file: truncated");
+}
+
+/// Reads the lines of `in` up to the `$End<name>` marker, keeping them when `keep` is set.
+std::string section_body(std::istream &in, std::string_view name, bool keep) {
+  const std::string end_marker = "$End" + std::string(name);
+  std::string body;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.starts_with(end_marker)) break;
+    if (keep) body.append(line).push_back('\n');
+  }
+  return body;
+}
+
+/// Section header of an MSH 4.1 `$Nodes` or `$Elements` section.
+std::array<std::size_t, 4> read_section_header(std::istream &in, bool is_binary) {
+  std::array<std::size_t, 4> header{};
+  if (is_binary) {
+    for (auto &value : header) value = read_value<std::size_t>(in);
+    return header;
+  }
+  auto line = header_line(in);
+  for (auto &value : header) line >> value;
+  if (!line) throw std::runtime_error("Invalid GMSH file: malformed number");
+  return header;
+}
+
+/// Header of an MSH 4.1 `NodesBlock` or `ElementBlock`.
+BlockIndex read_block_header(std::istream &in, bool is_binary) {
+  BlockIndex block;
+  if (is_binary) {
+    block.entity_dim = read_value<int>(in);
+    block.entity_tag = read_value<int>(in);
+    block.type = read_value<int>(in);
+    block.count = read_value<std::size_t>(in);
+  } else {
+    auto line = header_line(in);
+    line >> block.entity_dim >> block.entity_tag >> block.type >> block.count;
+    if (!line) throw std::runtime_error("Invalid GMSH file: malformed number");
+  }
+  if (block.entity_dim < 0 || block.entity_dim > 3) {
+    throw std::runtime_error("Invalid GMSH file: bad entity dimension");
+  }
+  return block;
+}
+
+/// `block` restricted to the `count` records held by `chunk`.
+BlockIndex chunk_block(const BlockIndex &block, std::string_view chunk, std::size_t count) {
+  BlockIndex part = block;
+  part.count = count;
+  part.first = 0;
+  part.records = {0, chunk.size(), {0}};
+  part.coords = part.records;
+  return part;
+}
+
+/**
+ * Reads the `block.count` records of a block (`record_size` bytes each, or one line each in
+ * ASCII mode) and calls `parse(chunk, part, first)` for every split, where `part` describes the
+ * split alone and `first` is the index of its first record within the block. Splits are read a
+ * batch at a time and parsed concurrently, so the text of a single batch is held at once.
+ */
+template <class Parse>
+void stream_splits(std::istream &in, const BlockIndex &block, bool is_binary,
+                   std::size_t record_size, Parse &&parse) {
+  const std::size_t n_splits = number_of_splits(block);
+  const std::size_t batch = std::max<std::size_t>(1, utils::default_thread_pool().size());
+  std::vector<std::string> chunks(std::min(batch, n_splits));
+  for (std::size_t first_split = 0; first_split < n_splits; first_split += batch) {
+    const std::size_t n = std::min(batch, n_splits - first_split);
+    for (std::size_t j = 0; j < n; ++j) {
+      chunks[j].clear();
+      const std::size_t count = split_size(block, first_split + j);
+      if (is_binary) {
+        read_bytes(in, count * record_size, chunks[j]);
+      } else {
+        read_lines(in, count, chunks[j]);
+      }
+    }
+    utils::parallel_for(n, [&](std::size_t j) {
+      const std::size_t split = first_split + j;
+      const std::string_view chunk = chunks[j];
+      parse(chunk, chunk_block(block, chunk, split_size(block, split)), split * records_per_split);
+    });
+  }
+}
+
+/// Nodes read from a stream, in file order.
+struct StreamedNodes {
+  std::vector<double> x{};
+  std::vector<std::size_t> tags{};
+  std::size_t min_tag{};
+  std::size_t max_tag{};
+};
+
+/// Reads the body of a `$Nodes` section.
+StreamedNodes stream_nodes(std::istream &in, const MeshFormatSection &format) {
+  const bool is_binary = format.is_binary;
+  StreamedNodes nodes;
+  if (format.is_legacy()) {
+    BlockIndex block;
+    block.entity_dim = -1;
+    block.entity_tag = -1;
+    block.legacy = true;
+    if (!(header_line(in) >> block.count)) {
+      throw std::runtime_error("Invalid GMSH file: malformed number");
+    }
+    nodes.x.resize(3 * block.count);
+    nodes.tags.resize(block.count);
+    constexpr std::size_t record_size = sizeof(int) + 3 * sizeof(double);
+    stream_splits(in, block, is_binary, record_size,
+                  [&](std::string_view chunk, const BlockIndex &part, std::size_t first) {
+                    read_node_tags(chunk, part, 0, is_binary, nodes.tags.data() + first);
+                    read_node_coords(chunk, part, 0, is_binary, nodes.x.data() + 3 * first);
+                  });
+    if (!nodes.tags.empty()) {
+      const auto [min_tag, max_tag] = std::ranges::minmax(nodes.tags);
+      nodes.min_tag = min_tag;
+      nodes.max_tag = max_tag;
+    }
+    return nodes;
+  }
+
+  const auto header = read_section_header(in, is_binary);
+  nodes.x.resize(3 * header[1]);
+  nodes.tags.resize(header[1]);
+  nodes.min_tag = header[2];
+  nodes.max_tag = header[3];
+  std::size_t first = 0;
+  for (std::size_t b = 0; b < header[0]; ++b) {
+    const BlockIndex block = read_block_header(in, is_binary);
+    if (block.count > header[1] - first) {
+      throw std::runtime_error("Invalid GMSH file: more nodes than declared");
+    }
+    stream_splits(in, block, is_binary, sizeof(std::size_t),
+                  [&](std::string_view chunk, const BlockIndex &part, std::size_t offset) {
+                    read_node_tags(chunk, part, 0, is_binary, nodes.tags.data() + first + offset);
+                  });
+    const std::size_t stride = 3 + (block.type ? block.entity_dim : 0);
+    stream_splits(in, block, is_binary, stride * sizeof(double),
+                  [&](std::string_view chunk, const BlockIndex &part, std::size_t offset) {
+                    read_node_coords(chunk, part, 0, is_binary,
+                                     nodes.x.data() + 3 * (first + offset));
+                  });
+    first += block.count;
+  }
+  return nodes;
+}
+
+/**
+ * Elements of one dimension read from a stream, in file order. Their final dimension is only
+ * known once the whole `$Elements` section is read, so high-order nodes are kept for all.
+ */
+struct StreamedElements {
+  /// A block of elements sharing a type, an entity and a physical group.
+  struct Run {
+    std::size_t sequence;  ///< Position of the block among the blocks read.
+    std::size_t first;
+    std::size_t count;
+    int type;
+  };
+
+  std::vector<std::size_t> vertices{};
+  std::vector<std::size_t> offsets{0};
+  std::vector<std::size_t> high_order{};
+  std::vector<std::size_t> high_order_offsets{0};
+  std::vector<oiseau::mesh::CellType> types{};
+  std::vector<std::int32_t> entity_tags{};
+  std::vector<std::int32_t> physical_tags{};
+  std::vector<Run> runs{};
+  bool is_high_order = false;
+
+  void start(std::size_t sequence, const BlockIndex &block, std::int32_t physical_tag) {
+    runs.push_back({sequence, types.size(), 0, block.type});
+    m_entity_tag = block.entity_tag;
+    m_physical_tag = physical_tag;
+  }
+
+  /// Appends `count` elements to the last block and returns the index of the first one.
+  std::size_t grow(std::size_t count) {
+    Run &run = runs.back();
+    const auto cell_type = gmsh_celltype_to_oiseau_celltype(run.type);
+    const std::size_t npc = gmsh_nodes_per_cell(run.type);
+    const std::size_t nv = oiseau::mesh::number_of_nodes(cell_type->kind(), 1);
+    is_high_order = is_high_order || gmsh_celltype_order(run.type) > 1;
+    const std::size_t first = types.size();
+    types.resize(first + count, cell_type);
+    entity_tags.resize(first + count, m_entity_tag);
+    physical_tags.resize(first + count, m_physical_tag);
+    for (std::size_t i = 0; i < count; ++i) {
+      offsets.push_back(offsets.back() + nv);
+      high_order_offsets.push_back(high_order_offsets.back() + npc - nv);
+    }
+    vertices.resize(offsets.back());
+    high_order.resize(high_order_offsets.back());
+    run.count += count;
+    return first;
+  }
+
+  /// Reads the records of `chunk`, described by `part`, into the elements from `first` on.
+  void read(std::string_view chunk, const BlockIndex &part, bool is_binary, std::size_t first) {
+    read_cell_nodes(chunk, part, 0, is_binary, vertices.data() + offsets[first],
+                    high_order.data() + high_order_offsets[first]);
+  }
+
+ private:
+  std::int32_t m_entity_tag = 0;
+  std::int32_t m_physical_tag = 0;
+};
+
+/// Type, physical tag and elementary tag of an ASCII MSH 2.2 element record.
+std::array<int, 3> legacy_element_key(std::string_view line) {
+  std::array<int, 5> values{};
+  const char *pos = line.data();
+  const char *end = pos + line.size();
+  std::size_t n = 0;
+  for (; n < values.size(); ++n) {
+    while (pos < end && (*pos == ' ' || *pos == '\t')) ++pos;
+    const auto [ptr, ec] = std::from_chars(pos, end, values[n]);
+    if (ec != std::errc()) break;
+    pos = ptr;
+  }
+  if (n < 3) throw std::runtime_error("Invalid GMSH file: malformed number");
+  const int num_tags = values[2];
+  return {values[1], num_tags > 0 ? values[3] : 0, num_tags > 1 ? values[4] : 0};
+}
+
+template <class T>
+T load(const char *src) {
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  return value;
+}
+}  // namespace
+
+oiseau::mesh::Mesh gmsh_stream_to_mesh(std::istream &in, const GMSHReadOptions &options) {
+  MeshFormatSection format{};
+  bool has_format = false;
+  bool has_entities = false;
+  bool has_nodes = false;
+  EntityPhysicalTags entity_tags;
+  StreamedNodes nodes;
+  std::array<StreamedElements, 4> elements;
+  std::size_t n_runs = 0;
+
+  // Reads an MSH 4.1 `$Elements` section, skipping the blocks `options` rejects.
+  auto stream_elements = [&] {
+    const bool is_binary = format.is_binary;
+    const auto header = read_section_header(in, is_binary);
+    for (std::size_t b = 0; b < header[0]; ++b) {
+      const BlockIndex block = read_block_header(in, is_binary);
+      const std::size_t record_size = (1 + gmsh_nodes_per_cell(block.type)) * sizeof(std::size_t);
+      if (!is_selected(block, options, entity_tags)) {
+        skip_records(in, block.count, record_size, is_binary);
+        continue;
+      }
+      auto &target = elements[block.entity_dim];
+      target.start(n_runs++, block, first_physical_tag(block, entity_tags));
+      const std::size_t first = target.grow(block.count);
+      stream_splits(in, block, is_binary, record_size,
+                    [&](std::string_view chunk, const BlockIndex &part, std::size_t offset) {
+                      target.read(chunk, part, is_binary, first + offset);
+                    });
+    }
+  };
+
+  // Reads an MSH 2.2 `$Elements` section a split at a time, cutting it into blocks as the
+  // indexer does.
+  auto stream_legacy_elements = [&] {
+    const bool is_binary = format.is_binary;
+    std::size_t count = 0;
+    if (!(header_line(in) >> count)) {
+      throw std::runtime_error("Invalid GMSH file: malformed number");
+    }
+    BlockIndex block;
+    block.legacy = true;
+    bool is_open = false;
+    StreamedElements *target = nullptr;
+    auto same_block = [&](int type, int physical_tag, int entity_tag) {
+      return is_open && block.type == type && block.physical_tag == physical_tag &&
+             block.entity_tag == entity_tag;
+    };
+    auto start = [&](int type, int physical_tag, int entity_tag) {
+      block.type = type;
+      block.physical_tag = physical_tag;
+      block.entity_tag = entity_tag;
+      block.entity_dim = gmsh_celltype_to_oiseau_celltype(type)->dimension();
+      is_open = true;
+      target = is_selected(block, options, entity_tags) ? &elements[block.entity_dim] : nullptr;
+      if (target) target->start(n_runs++, block, physical_tag);
+    };
+    // Appends the `n` records of `chunk` to the current block.
+    auto add = [&](std::string_view chunk, std::size_t n) {
+      if (!target || n == 0) return;
+      target->read(chunk, chunk_block(block, chunk, n), is_binary, target->grow(n));
+    };
+
+    std::string chunk;
+    if (!is_binary) {
+      std::size_t n = 0;
+      std::string line;
+      for (std::size_t i = 0; i < count; ++i) {
+        if (!std::getline(in, line)) throw std::runtime_error("Invalid GMSH file: truncated");
+        const auto [type, physical_tag, entity_tag] = legacy_element_key(line);
+        const bool same = same_block(type, physical_tag, entity_tag);
+        if (!same || n == records_per_split) {
+          add(chunk, n);
+          chunk.clear();
+          n = 0;
+        }
+        if (!same) start(type, physical_tag, entity_tag);
+        chunk.append(line).push_back('\n');
+        ++n;
+      }
+      add(chunk, n);
+      return;
+    }
+    for (std::size_t read = 0; read < count;) {
+      const int type = read_value<int>(in);
+      const auto n = static_cast<std::size_t>(read_value<int>(in));
+      block.num_tags = static_cast<std::size_t>(read_value<int>(in));
+      const std::size_t record_size =
+          (1 + block.num_tags + gmsh_nodes_per_cell(type)) * sizeof(int);
+      is_open = false;
+      for (std::size_t done = 0; done < n; done += records_per_split) {
+        const std::size_t m = std::min(records_per_split, n - done);
+        chunk.clear();
+        read_bytes(in, m * record_size, chunk);
+        const std::string_view records = chunk;
+        std::size_t begin = 0;
+        for (std::size_t r = 0; r < m; ++r) {
+          const char *record = records.data() + r * record_size;
+          const int physical_tag = block.num_tags > 0 ? load<int>(record + sizeof(int)) : 0;
+          const int entity_tag = block.num_tags > 1 ? load<int>(record + 2 * sizeof(int)) : 0;
+          if (same_block(type, physical_tag, entity_tag)) continue;
+          add(records.substr(begin * record_size, (r - begin) * record_size), r - begin);
+          start(type, physical_tag, entity_tag);
+          begin = r;
+        }
+        add(records.substr(begin * record_size), m - begin);
+      }
+      read += n;
+    }
+  };
+
+  std::string line;
+  while (std::getline(in, line)) {
+    line.erase(line.find_last_not_of(" \t\r") + 1);
+    if (!line.starts_with('$')) continue;
+    const std::string name = line.substr(1);
+    if (name == "MeshFormat") {
+      std::istringstream stream(section_body(in, name, true));
+      format = mesh_format_handler(stream);
+      has_format = true;
+      continue;
+    }
+    if (!has_format) throw std::runtime_error("Invalid GMSH file: missing $MeshFormat section");
+    if (name == "Entities") {
+      std::istringstream stream(section_body(in, name, true));
+      entity_tags = entity_physical_tags(stream, format.is_binary);
+      has_entities = true;
+      continue;
+    }
+    if (name == "Nodes") {
+      nodes = stream_nodes(in, format);
+      has_nodes = true;
+    } else if (name == "Elements") {
+      if (format.is_legacy()) {
+        stream_legacy_elements();
+      } else {
+        if (!options.physical_groups.empty() && !has_entities) {
+          throw std::runtime_error("Invalid GMSH file: physical groups need an $Entities section");
+        }
+        stream_elements();
+      }
+    }
+    section_body(in, name, false);
+  }
+  if (!has_format) throw std::runtime_error("Invalid GMSH file: missing $MeshFormat section");
+
+  // Elements of the highest dimension read become cells, lower-dimensional ones become facets,
+  // which keep their vertices only and are listed in file order.
+  int tdim = -1;
+  for (int d = 0; d < 4; ++d) {
+    if (!elements[d].runs.empty()) tdim = d;
+  }
+  StreamedElements cells = tdim >= 0 ? std::move(elements[tdim]) : StreamedElements{};
+  std::vector<std::pair<const StreamedElements *, const StreamedElements::Run *>> facet_runs;
+  for (int d = 0; d < tdim; ++d) {
+    for (const auto &run : elements[d].runs) facet_runs.emplace_back(&elements[d], &run);
+  }
+  std::ranges::sort(facet_runs, {}, [](const auto &entry) { return entry.second->sequence; });
+  std::vector<std::size_t> facet_offsets{0};
+  std::vector<std::size_t> facet_data;
+  std::vector<oiseau::mesh::CellType> facet_types;
+  std::vector<std::int32_t> facet_physical_tags;
+  for (const auto &[source, run] : facet_runs) {
+    const auto first = source->vertices.begin();
+    for (std::size_t i = run->first; i < run->first + run->count; ++i) {
+      facet_data.insert(facet_data.end(), first + source->offsets[i],
+                        first + source->offsets[i + 1]);
+      facet_offsets.push_back(facet_data.size());
+      facet_types.push_back(source->types[i]);
+      facet_physical_tags.push_back(source->physical_tags[i]);
+    }
+  }
+  elements = {};
+  if (!cells.is_high_order) {
+    cells.high_order = {};
+    cells.high_order_offsets = {};
+  }
+
+  if (has_nodes) {
+    const NodeTagMap tag_map(nodes.tags, nodes.min_tag, nodes.max_tag);
+    tag_map.remap(cells.vertices);
+    tag_map.remap(cells.high_order);
+    tag_map.remap(facet_data);
+  }
+  std::vector<double> x = std::move(nodes.x);
+  if (!options.selects_all() && has_nodes) {
+    // Keeps the referenced nodes only, renumbered in file order.
+    constexpr std::size_t unused = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> renumber(nodes.tags.size(), unused);
+    for (const auto *conn : {&cells.vertices, &cells.high_order, &facet_data}) {
+      for (const std::size_t node : *conn) renumber[node] = 0;
+    }
+    std::size_t n_used = 0;
+    for (std::size_t i = 0; i < renumber.size(); ++i) {
+      if (renumber[i] == unused) continue;
+      renumber[i] = n_used++;
+      std::copy_n(x.begin() + 3 * i, 3, x.begin() + 3 * renumber[i]);
+    }
+    x.resize(3 * n_used);
+    x.shrink_to_fit();
+    for (auto *conn : {&cells.vertices, &cells.high_order, &facet_data}) {
+      utils::parallel_for(
+          conn->size(), [&](std::size_t j) { (*conn)[j] = renumber[(*conn)[j]]; },
+          records_per_split);
+    }
+  }
+
+  oiseau::mesh::Geometry geometry =
+      cells.is_high_order
+          ? oiseau::mesh::Geometry(std::move(x), 3,
+                                   utils::JaggedArray<std::size_t>(
+                                       std::move(cells.high_order),
+                                       std::move(cells.high_order_offsets)))
+          : oiseau::mesh::Geometry(std::move(x), 3);
+  oiseau::mesh::FacetTable facets{
+      utils::JaggedArray<std::size_t>(std::move(facet_data), std::move(facet_offsets)),
+      std::move(facet_types), std::move(facet_physical_tags)};
+  oiseau::mesh::Topology topology(
+      utils::JaggedArray<std::size_t>(std::move(cells.vertices), std::move(cells.offsets)),
+      std::move(cells.types), std::move(facets));
+  topology.set_cell_attributes(std::move(cells.entity_tags), std::move(cells.physical_tags));
+  return {std::move(topology), std::move(geometry)};
 }
 }  // namespace detail
 
-oiseau::mesh::Mesh gmsh_read_from_string(const std::string &content) {
-  std::istringstream stream(content);
-  return gmsh_read_from_stream(stream);
+oiseau::mesh::Mesh gmsh_read_from_string(const std::string &content,
+                                         const GMSHReadOptions &options) {
+  return detail::gmsh_content_to_mesh(content, detail::index_file(content), options);
+}
+
+namespace {
+using Release = std::function<void(std::size_t, std::size_t)>;
+
+/**
+ * Calls `read(content, index, release)` on the mapped content of a regular file `path`. Files
+ * that cannot be mapped (pipes, devices) and compressed files are handed to
+ * `read_stream(stream, size_hint)` instead, the latter decompressed on the fly.
+ */
+template <class Read, class ReadStream>
+auto read_path(const std::filesystem::path &path, Read &&read, ReadStream &&read_stream) {
+  if (!std::filesystem::is_regular_file(path)) {
+    std::ifstream f_handler(path, std::ios::binary);
+    if (f_handler.fail()) throw std::runtime_error("Could not read file stream");
+    return read_stream(f_handler, std::size_t{0});
+  }
+  detail::MappedFile file(path);
+  if (const auto compression = detail::detect_compression(file.view());
+      compression != detail::Compression::None) {
+    // Decoding runs ahead on its own thread while the reader parses the chunks already
+    // decoded, so decompression overlaps with parsing.
+    detail::DecompressingStreambuf buffer(std::move(file), compression);
+    std::istream stream(&buffer);
+    stream.exceptions(std::ios::badbit);
+    return read_stream(stream, buffer.size_hint());
+  }
+  const detail::FileIndex index = detail::index_file(file.view());
+  return read(file.view(), index, [&file](std::size_t begin, std::size_t end) {
+    file.release(begin, end);
+  });
+}
+}  // namespace
+
+oiseau::mesh::Mesh gmsh_read_from_path(const std::filesystem::path &path,
+                                       const GMSHReadOptions &options) {
+  return read_path(
+      path,
+      [&](std::string_view content, const detail::FileIndex &index, const Release &release) {
+        return detail::gmsh_content_to_mesh(content, index, options, release);
+      },
+      [&](std::istream &stream, std::size_t) {
+        return detail::gmsh_stream_to_mesh(stream, options);
+      });
 }
 
-oiseau::mesh::Mesh gmsh_read_from_path(const std::filesystem::path &path) {
-  std::ifstream f_handler(path);
-  return gmsh_read_from_stream(f_handler);
+GMSHPartition gmsh_read_partition(const std::filesystem::path &path, int partition,
+                                  const GMSHReadOptions &options) {
+  // `$GhostElements` follows `$Elements`, so a partition is only read from the whole content.
+  return read_path(
+      path,
+      [&](std::string_view content, const detail::FileIndex &index, const Release &release) {
+        return detail::gmsh_content_to_partition(content, index, partition, options, release);
+      },
+      [&](std::istream &stream, std::size_t size_hint) {
+        const std::string content = detail::read_all(stream, size_hint);
+        return detail::gmsh_content_to_partition(content, detail::index_file(content), partition,
+                                                 options);
+      });
 }
 
-oiseau::mesh::Mesh gmsh_read_from_stream(std::istream &f_handler) {
-  GMSHFile file = GMSHFile(f_handler);
+oiseau::mesh::Mesh gmsh_read_from_stream(std::istream &f_handler,
+                                         const GMSHReadOptions &options) {
+  if (f_handler.fail()) throw std::runtime_error("Could not read file stream");
+  return detail::gmsh_stream_to_mesh(f_handler, options);
+}
+
+oiseau::mesh::Mesh gmsh_file_to_mesh(const GMSHFile &file) {
+  const auto &blocks = file.elements_section.blocks;
+  int tdim = -1;
+  for (const auto &block : blocks) tdim = std::max(tdim, block.entity_dim);
+  std::size_t n_cells = 0;
+  std::size_t n_facets = 0;
+  for (const auto &block : blocks) {
+    (block.entity_dim == tdim ? n_cells : n_facets) += block.num_elements_in_block;
+  }
   std::vector<double> x;
-  std::vector<std::vector<std::size_t>> conn;
-  std::vector<oiseau::mesh::CellType> cell_types;
+  std::vector<std::size_t> offsets(n_cells + 1, 0);
+  std::vector<std::size_t> data;
+  std::vector<oiseau::mesh::CellType> cell_types(n_cells);
+  std::vector<std::int32_t> cell_entity_tags(n_cells);
+  std::vector<std::int32_t> cell_physical_tags(n_cells);
+  std::vector<std::size_t> facet_offsets(n_facets + 1, 0);
+  std::vector<std::size_t> facet_data;
+  std::vector<oiseau::mesh::CellType> facet_types(n_facets);
+  std::vector<std::int32_t> facet_physical_tags(n_facets, 0);
 
+  std::vector<std::size_t> node_tags;
   x.reserve(file.nodes_section.num_nodes * 3);
-  for (auto &block : file.nodes_section.blocks) {
+  node_tags.reserve(file.nodes_section.num_nodes);
+  for (const auto &block : file.nodes_section.blocks) {
     x.insert(x.end(), block.node_coords.begin(), block.node_coords.end());
+    node_tags.insert(node_tags.end(), block.node_tags.begin(), block.node_tags.end());
   }
 
-  cell_types.reserve(file.elements_section.num_elements);
-  conn.reserve(file.elements_section.num_elements);
-
-  for (const auto &block : file.elements_section.blocks) {
-    std::size_t elem_size = block.data.size() / block.num_elements_in_block;
-    for (std::size_t i = 0; i < block.num_elements_in_block; ++i) {
-      std::vector<std::size_t> tmp;
-      tmp.reserve(elem_size - 1);
-      for (std::size_t j = 1; j < elem_size; ++j) {
-        tmp.emplace_back(block.data[i * elem_size + j] - 1);
+  const bool high_order = std::ranges::any_of(blocks, [&](const ElementBlock &block) {
+    return block.entity_dim == tdim && detail::gmsh_celltype_order(block.element_type) > 1;
+  });
+  std::vector<std::size_t> high_order_offsets(high_order ? n_cells + 1 : 0, 0);
+  std::vector<std::size_t> high_order_data;
+  std::size_t first = 0;
+  std::size_t first_facet = 0;
+  for (const auto &block : blocks) {
+    const std::size_t count = block.num_elements_in_block;
+    const std::size_t npc = detail::gmsh_nodes_per_cell(block.element_type);
+    auto cell_type = detail::gmsh_celltype_to_oiseau_celltype(block.element_type);
+    const std::size_t nv = oiseau::mesh::number_of_nodes(cell_type->kind(), 1);
+    std::vector<std::size_t> cell_nodes(count * npc);
+    detail::copy_connectivity(reinterpret_cast<const char *>(block.data.data()), count, npc,
+                              cell_nodes.data());
+    // MSH 4.1 physical groups belong to the entity, MSH 2.2 ones to the block.
+    const auto &entities = file.entities_section.blocks[block.entity_dim];
+    const auto entity = std::ranges::find(entities, static_cast<std::size_t>(block.entity_tag),
+                                          &EntityEntry::tag);
+    int physical = block.physical_tag;
+    if (entity != entities.end() && !entity->physical_tags.empty()) {
+      physical = entity->physical_tags.front();
+    }
+    if (block.entity_dim != tdim) {
+      std::fill_n(facet_types.begin() + first_facet, count, cell_type);
+      std::fill_n(facet_physical_tags.begin() + first_facet, count, physical);
+      for (std::size_t i = first_facet; i < first_facet + count; ++i) {
+        facet_offsets[i + 1] = facet_offsets[i] + nv;
       }
-      cell_types.emplace_back(detail::gmsh_celltype_to_oiseau_celltype(block.element_type));
-      conn.emplace_back(std::move(tmp));
+      facet_data.resize(facet_offsets[first_facet + count]);
+      detail::split_cell_nodes(cell_nodes.data(), count, npc, nv,
+                               facet_data.data() + facet_offsets[first_facet], nullptr);
+      first_facet += count;
+      continue;
+    }
+    std::fill_n(cell_types.begin() + first, count, cell_type);
+    std::fill_n(cell_entity_tags.begin() + first, count, block.entity_tag);
+    std::fill_n(cell_physical_tags.begin() + first, count, physical);
+    for (std::size_t i = first; i < first + count; ++i) {
+      offsets[i + 1] = offsets[i] + nv;
+      if (high_order) high_order_offsets[i + 1] = high_order_offsets[i] + npc - nv;
     }
+    data.resize(offsets[first + count]);
+    if (high_order) high_order_data.resize(high_order_offsets[first + count]);
+    detail::split_cell_nodes(cell_nodes.data(), count, npc, nv, data.data() + offsets[first],
+                             high_order ? high_order_data.data() + high_order_offsets[first]
+                                        : nullptr);
+    first += count;
   }
+  const detail::NodeTagMap tag_map(node_tags, file.nodes_section.min_node_tag,
+                                   file.nodes_section.max_node_tag);
+  tag_map.remap(data);
+  tag_map.remap(high_order_data);
+  tag_map.remap(facet_data);
 
-  oiseau::mesh::Geometry geometry = oiseau::mesh::Geometry(std::move(x), 3);
-  oiseau::mesh::Topology topology = oiseau::mesh::Topology(std::move(conn), std::move(cell_types));
+  oiseau::mesh::Geometry geometry =
+      high_order ? oiseau::mesh::Geometry(std::move(x), 3,
+                                          utils::JaggedArray<std::size_t>(
+                                              std::move(high_order_data),
+                                              std::move(high_order_offsets)))
+                 : oiseau::mesh::Geometry(std::move(x), 3);
+  oiseau::mesh::FacetTable facets{
+      utils::JaggedArray<std::size_t>(std::move(facet_data), std::move(facet_offsets)),
+      std::move(facet_types), std::move(facet_physical_tags)};
+  oiseau::mesh::Topology topology = oiseau::mesh::Topology(
+      utils::JaggedArray<std::size_t>(std::move(data), std::move(offsets)), std::move(cell_types),
+      std::move(facets));
+  topology.set_cell_attributes(std::move(cell_entity_tags), std::move(cell_physical_tags));
   oiseau::mesh::Mesh mesh(std::move(topology), std::move(geometry));
   return mesh;
-};
-
-void gmsh_write(const std::string &filename, const oiseau::mesh::Mesh &mesh) {
-  throw std::logic_error("gmsh_write not implemented yet.");
-};
+}
 
 }  // namespace oiseau::io
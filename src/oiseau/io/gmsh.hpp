@@ -8,19 +8,146 @@
 
 #include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <istream>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "oiseau/mesh/cell.hpp"
 #include "oiseau/mesh/mesh.hpp"
 
+namespace oiseau::io {
+class GMSHFile;
+
+/**
+ * @brief Selects the elements to read from an MSH file.
+ *
+ * An element block is read if it passes every non-empty filter, so with no filter set the whole
+ * file is read. Entities and physical groups are given as `(dimension, tag)` pairs; physical
+ * groups are resolved through `$Entities` (MSH 4.1) or the first tag of every element (MSH 2.2).
+ * Only the nodes referenced by the selected elements are loaded, in file order.
+ *
+ * Selected elements of the highest dimension become the cells of the mesh, each recording its
+ * entity and first physical tag in `Topology::entity_tags()` and `Topology::physical_tags()`;
+ * lower-dimensional ones are kept as `Topology::facets()`, with their vertices and first
+ * physical tag.
+ */
+struct GMSHReadOptions {
+  std::vector<int> dimensions{};
+  std::vector<std::pair<int, int>> entities{};
+  std::vector<std::pair<int, int>> physical_groups{};
+
+  inline bool selects_all() const {
+    return dimensions.empty() && entities.empty() && physical_groups.empty();
+  }
+};
+
+/**
+ * @brief The cells of one partition of a partitioned MSH 4.1 file and its ghost cells.
+ *
+ * The first `num_owned_cells` cells of `mesh` belong to the partition; the ghost cells follow,
+ * in file order, and `ghost_owners[i]` is the partition owning cell `num_owned_cells + i`.
+ */
+struct GMSHPartition {
+  oiseau::mesh::Mesh mesh;
+  std::size_t num_owned_cells{};
+  std::vector<int> ghost_owners{};
+};
+}  // namespace oiseau::io
+
 namespace oiseau::io::detail {
+struct FileIndex;
+
 oiseau::mesh::CellType gmsh_celltype_to_oiseau_celltype(const std::size_t s);
-}
+unsigned gmsh_celltype_order(const std::size_t s);
+int oiseau_celltype_to_gmsh_celltype(oiseau::mesh::CellType cell_type, unsigned order = 1);
+
+/**
+ * @brief Builds a mesh straight from the indexed blocks of an in-memory MSH 4.1 or 2.2 file.
+ *
+ * Coordinates and connectivity are parsed directly into the final `Geometry` and `Topology`
+ * buffers, so no intermediate `GMSHFile` is materialized. Element blocks rejected by `options`
+ * are never parsed, nor are node splits without a referenced node. When given, `release` is
+ * called with the byte range of `$Nodes` and of `$Elements` as soon as each section has been
+ * consumed.
+ */
+oiseau::mesh::Mesh gmsh_content_to_mesh(
+    std::string_view content, const FileIndex& index, const GMSHReadOptions& options = {},
+    const std::function<void(std::size_t, std::size_t)>& release = {});
+
+/**
+ * @brief Builds the mesh of partition `partition` of an in-memory partitioned MSH 4.1 file.
+ *
+ * Only the element blocks of the entities of the partition (`$PartitionedEntities`), the blocks
+ * holding its ghost elements (`$GhostElements`) and the nodes they reference are parsed. With
+ * `partition == 0` the whole file is read, as by `gmsh_content_to_mesh`.
+ */
+GMSHPartition gmsh_content_to_partition(
+    std::string_view content, const FileIndex& index, int partition,
+    const GMSHReadOptions& options = {},
+    const std::function<void(std::size_t, std::size_t)>& release = {});
+
+/**
+ * @brief Builds a mesh from an MSH 4.1 or 2.2 file read sequentially from `f_handler`.
+ *
+ * Blocks are read a batch of `records_per_split` splits at a time and every batch is parsed
+ * concurrently straight into the `Geometry` and `Topology` buffers, so the raw text is never held
+ * in full. Unselected element blocks are skipped without being parsed; the coordinates of every
+ * node are read, since `$Nodes` precedes the elements that select them, and unused ones are
+ * dropped afterwards.
+ */
+oiseau::mesh::Mesh gmsh_stream_to_mesh(std::istream& f_handler,
+                                       const GMSHReadOptions& options = {});
+}  // namespace oiseau::io::detail
 
 namespace oiseau::io {
-oiseau::mesh::Mesh gmsh_read_from_path(const std::filesystem::path& path);
-oiseau::mesh::Mesh gmsh_read_from_string(const std::string&);
-oiseau::mesh::Mesh gmsh_read_from_stream(std::istream& f_handler);
-void gmsh_write(const std::string& filename, const oiseau::mesh::Mesh& mesh);
+/// Reads an MSH file; gzip (.msh.gz) and zstd (.msh.zst) files are parsed as they are decompressed.
+oiseau::mesh::Mesh gmsh_read_from_path(const std::filesystem::path& path,
+                                       const GMSHReadOptions& options = {});
+oiseau::mesh::Mesh gmsh_read_from_string(const std::string&, const GMSHReadOptions& options = {});
+/**
+ * @brief Reads an MSH file from a stream, one split of records at a time.
+ *
+ * Peak memory is the mesh plus a batch of splits of text. Regular files are better read with
+ * `gmsh_read_from_path`, which maps them and parses every block concurrently.
+ */
+oiseau::mesh::Mesh gmsh_read_from_stream(std::istream& f_handler,
+                                         const GMSHReadOptions& options = {});
+
+/**
+ * @brief Reads partition `partition` (from 1) of a partitioned MSH 4.1 file and its ghost cells.
+ *
+ * Every rank or worker can read its own share of the same file concurrently; elements and nodes
+ * of other partitions are skipped without being parsed. `options` further filters the cells
+ * and facets of the partition. Throws `std::runtime_error` if the file is not partitioned and
+ * `std::invalid_argument` if it has no partition `partition`.
+ */
+GMSHPartition gmsh_read_partition(const std::filesystem::path& path, int partition,
+                                  const GMSHReadOptions& options = {});
+
+/// Builds a mesh from an already parsed file, for callers that also need its sections.
+oiseau::mesh::Mesh gmsh_file_to_mesh(const GMSHFile& file);
+
+/// Output settings of `gmsh_write`.
+struct GMSHWriteOptions {
+  bool binary = false;  ///< Write the binary rather than the ASCII flavour of MSH 4.1.
+};
+
+/**
+ * @brief Writes a mesh as an MSH 4.1 file.
+ *
+ * Nodes and elements are tagged consecutively from 1 in mesh order. Consecutive cells of the
+ * same type and entity form one element block, so reading the file back yields the same cell
+ * ordering and cell attributes.
+ */
+void gmsh_write(const std::filesystem::path& path, const oiseau::mesh::Mesh& mesh,
+                const GMSHWriteOptions& options = {});
+
+/// Writes `partitions[i]` to `paths[i]`, writing the files concurrently.
+void gmsh_write_partitions(std::span<const std::filesystem::path> paths,
+                           std::span<const oiseau::mesh::Mesh> partitions,
+                           const GMSHWriteOptions& options = {});
 }  // namespace oiseau::io
@@ -9,14 +9,14 @@
 #include <array>
 #include <cstddef>
 #include <istream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
-#include <xtensor/containers/xadapt.hpp>
 
-enum { PREFIX = '$' };
+#include "oiseau/io/gmsh_index.hpp"
 
 namespace oiseau::io {
 
@@ -34,11 +34,39 @@ std::size_t gmsh_nodes_per_cell(const std::size_t s) {
   case 5:
     return 8;  // hexahedron
   case 6:
-    return 6;  // prism?
+    return 6;  // prism
   case 7:
-    return 5;  // wedge
+    return 5;  // pyramid
+  case 8:
+    return 3;  // 3-node second order line
+  case 9:
+    return 6;  // 6-node second order triangle
+  case 10:
+    return 9;  // 9-node second order quadrangle
+  case 11:
+    return 10;  // 10-node second order tetrahedron
+  case 12:
+    return 27;  // 27-node second order hexahedron
   case 15:
     return 1;  // vertex
+  case 21:
+    return 10;  // 10-node third order triangle
+  case 23:
+    return 15;  // 15-node fourth order triangle
+  case 25:
+    return 21;  // 21-node fifth order triangle
+  case 26:
+    return 4;  // 4-node third order line
+  case 27:
+    return 5;  // 5-node fourth order line
+  case 28:
+    return 6;  // 6-node fifth order line
+  case 36:
+    return 16;  // 16-node third order quadrangle
+  case 37:
+    return 25;  // 25-node fourth order quadrangle
+  case 38:
+    return 36;  // 36-node fifth order quadrangle
   default:
     throw std::runtime_error("Unknown GMSH cell type: " + std::to_string(s));
   }
@@ -71,20 +99,22 @@ std::vector<T> from_file(std::istream& f, std::size_t n, bool is_binary = false)
 
 MeshFormatSection mesh_format_handler(std::istream& f_handler) {
   auto [version] = from_file<double, 1>(f_handler);
-  if (version != 4.1) {
+  if (version != 4.1 && version != 2.2) {
     throw std::runtime_error(
         "Unsupported GMSH version detected."
-        "Please ensure you are using version 4.1.");
+        "Please ensure you are using version 4.1 or 2.2.");
   }
   auto [is_binary] = from_file<int, 1>(f_handler);
-  auto [size_t_size] = from_file<std::size_t, 1>(f_handler);
+  // MSH 4.1 stores sizeof(size_t) here, MSH 2.2 stores sizeof(double).
+  auto [data_size] = from_file<std::size_t, 1>(f_handler);
   if (is_binary) {
     f_handler.get();  // skip NF
     auto [verify_one] = from_file<int, 1>(f_handler, true);
     if (verify_one != 1) throw std::runtime_error("Invalid GMSH file");
-    if (size_t_size != sizeof(std::size_t)) throw std::runtime_error("Invalid GMSH file");
+    const std::size_t expected = version == 2.2 ? sizeof(double) : sizeof(std::size_t);
+    if (data_size != expected) throw std::runtime_error("Invalid GMSH file");
   }
-  return {version, is_binary, size_t_size};
+  return {version, is_binary, data_size};
 }
 
 PhysicalNamesSection physical_names_handler(std::istream& f_handler) {
@@ -128,6 +158,53 @@ EntitiesSection entities_handler(std::istream& f_handler, bool is_binary) {
   return EntitiesSection(std::move(blocks));
 }
 
+PartitionedEntitiesSection partitioned_entities_handler(std::istream& f_handler,
+                                                        bool is_binary) {
+  PartitionedEntitiesSection section;
+  auto [num_partitions, num_ghost_entities] = from_file<std::size_t, 2>(f_handler, is_binary);
+  section.num_partitions = num_partitions;
+  section.ghost_entities.reserve(num_ghost_entities);
+  for (std::size_t i = 0; i < num_ghost_entities; i++) {
+    auto [tag, partition] = from_file<int, 2>(f_handler, is_binary);
+    section.ghost_entities.emplace_back(tag, partition);
+  }
+  auto quantity = from_file<std::size_t, 4>(f_handler, is_binary);
+  for (int d = 0; d < 4; d++) {
+    section.blocks.at(d).reserve(quantity[d]);
+    for (std::size_t j = 0; j < quantity[d]; j++) {
+      auto [tag, parent_dim, parent_tag] = from_file<int, 3>(f_handler, is_binary);
+      PartitionedEntityEntry entity{static_cast<std::size_t>(tag), parent_dim, parent_tag};
+      auto [num_partitions_of_entity] = from_file<std::size_t, 1>(f_handler, is_binary);
+      entity.partitions = from_file<int>(f_handler, num_partitions_of_entity, is_binary);
+      entity.boundary_coords = from_file<double>(f_handler, (d == 0) ? 3 : 6, is_binary);
+      auto [num_physicals] = from_file<std::size_t, 1>(f_handler, is_binary);
+      entity.physical_tags = from_file<int>(f_handler, num_physicals, is_binary);
+      if (d > 0) {
+        auto [num_BREP] = from_file<std::size_t, 1>(f_handler, is_binary);
+        entity.bounding_tags = from_file<int>(f_handler, num_BREP, is_binary);
+      }
+      section.blocks.at(d).push_back(std::move(entity));
+    }
+  }
+  if (f_handler.fail()) throw std::runtime_error("Invalid GMSH file: bad $PartitionedEntities");
+  return section;
+}
+
+GhostElementsSection ghost_elements_handler(std::istream& f_handler, bool is_binary) {
+  GhostElementsSection section;
+  auto [num_ghost_elements] = from_file<std::size_t, 1>(f_handler, is_binary);
+  section.elements.reserve(num_ghost_elements);
+  for (std::size_t i = 0; i < num_ghost_elements; i++) {
+    auto [element_tag] = from_file<std::size_t, 1>(f_handler, is_binary);
+    auto [owner] = from_file<int, 1>(f_handler, is_binary);
+    auto [num_ghost_partitions] = from_file<std::size_t, 1>(f_handler, is_binary);
+    section.elements.push_back(
+        {element_tag, owner, from_file<int>(f_handler, num_ghost_partitions, is_binary)});
+  }
+  if (f_handler.fail()) throw std::runtime_error("Invalid GMSH file: bad $GhostElements");
+  return section;
+}
+
 NodesSection nodes_handler(std::istream& f_handler, bool is_binary) {
   auto [num_entity_blocks, total_num_nodes, min_node_tag, max_node_tag] =
       from_file<std::size_t, 4>(f_handler, is_binary);
@@ -138,18 +215,18 @@ NodesSection nodes_handler(std::istream& f_handler, bool is_binary) {
   for (std::size_t i = 0; i < num_entity_blocks; i++) {
     auto [dim, entity_tag, parametric] = from_file<int, 3>(f_handler, is_binary);
     auto [quantity] = from_file<std::size_t, 1>(f_handler, is_binary);
-    std::vector<std::size_t> node_tags;
+    auto node_tags = from_file<std::size_t>(f_handler, quantity, is_binary);
     std::vector<double> node_coords;
-    node_tags.reserve(quantity);
-    node_coords.reserve(quantity * 3);
-
-    for (std::size_t j = 0; j < quantity; j++) {
-      auto [tag] = from_file<std::size_t, 1>(f_handler, is_binary);
-      node_tags.emplace_back(tag);
-    }
-    for (std::size_t j = 0; j < quantity; j++) {
-      auto xyz = from_file<double, 3>(f_handler, is_binary);
-      node_coords.insert(node_coords.end(), xyz.begin(), xyz.end());
+    if (is_binary && !parametric) {
+      node_coords = from_file<double>(f_handler, quantity * 3, is_binary);
+    } else {
+      node_coords.reserve(quantity * 3);
+      const std::size_t n_params = parametric ? dim : 0;
+      for (std::size_t j = 0; j < quantity; j++) {
+        auto xyz = from_file<double, 3>(f_handler, is_binary);
+        node_coords.insert(node_coords.end(), xyz.begin(), xyz.end());
+        from_file<double>(f_handler, n_params, is_binary);
+      }
     }
     blocks.emplace_back(dim, entity_tag, parametric, quantity, std::move(node_tags),
                         std::move(node_coords));
@@ -173,36 +250,35 @@ ElementSection elements_handler(std::istream& f_handler, bool is_binary) {
   }
   return {num_element_blocks, num_elements, min_element_tag, max_element_tag, std::move(blocks)};
 };
-
-void skip_to_end_of_environment(std::istream& f_handler) {
-  std::string line;
-  while (getline(f_handler, line)) {
-    if (line.starts_with(PREFIX)) break;
-  }
-}
 }  // namespace detail
 
 void GMSHFile::read(std::istream& f_handler) {
-  using namespace detail;
   if (f_handler.fail()) throw std::runtime_error("Could not read file stream");
-  std::string line;
-  bool is_binary;
-  while (getline(f_handler, line)) {
-    if (line.starts_with(PREFIX)) {
-      line = line.substr(1);
-      if (line == "MeshFormat") {
-        mesh_format_section = mesh_format_handler(f_handler);
-        is_binary = mesh_format_section.is_binary;
-      } else if (line == "PhysicalNames") {
-        physical_names_section = physical_names_handler(f_handler);
-      } else if (line == "Entities") {
-        entities_section = entities_handler(f_handler, is_binary);
-      } else if (line == "Nodes") {
-        nodes_section = nodes_handler(f_handler, is_binary);
-      } else if (line == "Elements") {
-        elements_section = elements_handler(f_handler, is_binary);
-      }
-      skip_to_end_of_environment(f_handler);
+  read(detail::read_all(f_handler));
+}
+
+void GMSHFile::read(std::string_view content) {
+  using namespace detail;
+  const FileIndex index = index_file(content);
+  mesh_format_section = index.format;
+  const bool is_binary = mesh_format_section.is_binary;
+  for (const auto& section : index.sections) {
+    if (section.name == "PhysicalNames") {
+      std::istringstream stream(std::string(section.body(content)));
+      physical_names_section = physical_names_handler(stream);
+    } else if (section.name == "Entities") {
+      std::istringstream stream(std::string(section.body(content)));
+      entities_section = entities_handler(stream, is_binary);
+    } else if (section.name == "PartitionedEntities") {
+      std::istringstream stream(std::string(section.body(content)));
+      partitioned_entities_section = partitioned_entities_handler(stream, is_binary);
+    } else if (section.name == "GhostElements") {
+      std::istringstream stream(std::string(section.body(content)));
+      ghost_elements_section = ghost_elements_handler(stream, is_binary);
+    } else if (section.name == "Nodes") {
+      nodes_section = parse_nodes(content, section, is_binary);
+    } else if (section.name == "Elements") {
+      elements_section = parse_elements(content, section, is_binary);
     }
   }
 }
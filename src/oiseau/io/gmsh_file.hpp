@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <istream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -23,6 +24,9 @@ struct MeshFormatSection {
   MeshFormatSection() = default;
   MeshFormatSection(double version, int is_binary, std::size_t data_size)
       : version(version), is_binary(is_binary), data_size(data_size) {}
+
+  /// True for MSH 2.2 files, whose `$Nodes` and `$Elements` have no entity blocks.
+  inline bool is_legacy() const { return version < 3; }
 };
 
 struct EntityEntry {
@@ -51,6 +55,35 @@ struct EntitiesSection {
   explicit EntitiesSection(std::array<std::vector<EntityEntry>, 4>&& blocks) : blocks(blocks) {}
 };
 
+/// An entity of one or more partitions, split off the model entity `(parent_dim, parent_tag)`.
+struct PartitionedEntityEntry {
+  std::size_t tag{};
+  int parent_dim{};
+  int parent_tag{};
+  std::vector<int> partitions{};
+  std::vector<double> boundary_coords{};
+  std::vector<int> physical_tags{};
+  std::vector<int> bounding_tags{};
+};
+
+struct PartitionedEntitiesSection {
+  std::size_t num_partitions{};
+  /// `(entity tag, partition)` of the entities holding the ghost cells of a partition.
+  std::vector<std::pair<int, int>> ghost_entities{};
+  std::array<std::vector<PartitionedEntityEntry>, 4> blocks{};
+};
+
+/// An element owned by partition `owner` and present as a ghost in `partitions`.
+struct GhostElement {
+  std::size_t element_tag{};
+  int owner{};
+  std::vector<int> partitions{};
+};
+
+struct GhostElementsSection {
+  std::vector<GhostElement> elements{};
+};
+
 struct PhysicalNamesSection {
   int num_physical_names{};
   std::vector<int> dimensions{};
@@ -107,6 +140,7 @@ struct ElementBlock {
   int element_type;
   std::size_t num_elements_in_block;
   std::vector<std::size_t> data;
+  int physical_tag{};  ///< MSH 2.2 only; MSH 4.1 physical groups are held by the entities.
 
   ElementBlock(int entity_dim, int entity_tag, int element_type, std::size_t num_elements_in_block,
                std::vector<std::size_t>&& data)
@@ -147,21 +181,28 @@ class GMSHFile {
         elements_section(std::move(elements_section)) {}
 
   explicit GMSHFile(std::istream& f_handler) { read(f_handler); }
+  explicit GMSHFile(std::string_view content) { read(content); }
 
   MeshFormatSection mesh_format_section;
   PhysicalNamesSection physical_names_section;
   EntitiesSection entities_section;
   NodesSection nodes_section;
   ElementSection elements_section;
+  PartitionedEntitiesSection partitioned_entities_section{};
+  GhostElementsSection ghost_elements_section{};
 
  private:
   void read(std::istream& f_handler);
+  void read(std::string_view content);
 };
 
 namespace detail {
+std::size_t gmsh_nodes_per_cell(std::size_t s);
 MeshFormatSection mesh_format_handler(std::istream& f_handler);
 PhysicalNamesSection physical_names_handler(std::istream& f_handler);
 EntitiesSection entities_handler(std::istream& f_handler, bool is_binary);
+PartitionedEntitiesSection partitioned_entities_handler(std::istream& f_handler, bool is_binary);
+GhostElementsSection ghost_elements_handler(std::istream& f_handler, bool is_binary);
 NodesSection nodes_handler(std::istream& f_handler, bool is_binary);
 ElementSection elements_handler(std::istream& f_handler, bool is_binary);
 
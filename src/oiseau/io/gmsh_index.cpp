@@ -0,0 +1,647 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/gmsh_index.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "oiseau/io/gmsh.hpp"
+#include "oiseau/io/gmsh_file.hpp"
+#include "oiseau/utils/thread_pool.hpp"
+
+enum { PREFIX = '$' };
+
+namespace oiseau::io::detail {
+
+namespace {
+
+/// Minimal whitespace-separated number reader over a bounded character range.
+class TextCursor {
+ public:
+  TextCursor(const char* first, const char* last) : m_pos(first), m_end(last) {}
+
+  template <class T>
+  T next() {
+    while (m_pos < m_end && is_space(*m_pos)) ++m_pos;
+    if constexpr (std::is_floating_point_v<T>) {
+      if (m_pos < m_end && *m_pos == '+') ++m_pos;
+    }
+    T value{};
+    auto [ptr, ec] = std::from_chars(m_pos, m_end, value);
+    if (ec != std::errc()) throw std::runtime_error("Invalid GMSH file: malformed number");
+    m_pos = ptr;
+    return value;
+  }
+
+  void skip_line() {
+    const void* eol = std::memchr(m_pos, '\n', m_end - m_pos);
+    m_pos = eol ? static_cast<const char*>(eol) + 1 : m_end;
+  }
+
+  const char* position() const { return m_pos; }
+
+ private:
+  static bool is_space(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+  const char* m_pos;
+  const char* m_end;
+};
+
+std::size_t next_line(std::string_view content, std::size_t pos) {
+  auto eol = content.find('\n', pos);
+  return eol == std::string_view::npos ? content.size() : eol + 1;
+}
+
+std::string_view trim(std::string_view line) {
+  auto last = line.find_last_not_of(" \t\r\n");
+  return last == std::string_view::npos ? std::string_view{} : line.substr(0, last + 1);
+}
+
+template <class T>
+T read_binary(std::string_view content, std::size_t& pos) {
+  if (pos + sizeof(T) > content.size()) throw std::runtime_error("Invalid GMSH file: truncated");
+  T value;
+  std::memcpy(&value, content.data() + pos, sizeof(T));
+  pos += sizeof(T);
+  return value;
+}
+
+RecordRange fixed_records(std::string_view content, std::size_t pos, std::size_t count,
+                          std::size_t record_size) {
+  RecordRange range{pos, pos + count * record_size, {}};
+  if (range.end > content.size()) throw std::runtime_error("Invalid GMSH file: truncated");
+  return range;
+}
+
+RecordRange text_records(std::string_view content, std::size_t pos, std::size_t count) {
+  RecordRange range{pos, pos, {}};
+  range.splits.reserve(count / records_per_split + 1);
+  for (std::size_t i = 0; i < count; ++i) {
+    if (pos >= content.size()) throw std::runtime_error("Invalid GMSH file: truncated");
+    if (i % records_per_split == 0) range.splits.push_back(pos);
+    pos = next_line(content, pos);
+  }
+  range.end = pos;
+  return range;
+}
+
+std::size_t index_blocks(std::string_view content, SectionIndex& section, bool is_binary,
+                         bool is_nodes) {
+  std::size_t pos = section.begin;
+  if (is_binary) {
+    for (auto& value : section.header) value = read_binary<std::size_t>(content, pos);
+  } else {
+    TextCursor cursor(content.data() + pos, content.data() + content.size());
+    for (auto& value : section.header) value = cursor.next<std::size_t>();
+    pos = next_line(content, cursor.position() - content.data());
+  }
+
+  section.blocks.reserve(section.header[0]);
+  std::size_t first = 0;
+  for (std::size_t i = 0; i < section.header[0]; ++i) {
+    BlockIndex block;
+    block.header = pos;
+    if (is_binary) {
+      block.entity_dim = read_binary<int>(content, pos);
+      block.entity_tag = read_binary<int>(content, pos);
+      block.type = read_binary<int>(content, pos);
+      block.count = read_binary<std::size_t>(content, pos);
+    } else {
+      TextCursor cursor(content.data() + pos, content.data() + content.size());
+      block.entity_dim = cursor.next<int>();
+      block.entity_tag = cursor.next<int>();
+      block.type = cursor.next<int>();
+      block.count = cursor.next<std::size_t>();
+      pos = next_line(content, cursor.position() - content.data());
+    }
+    block.first = first;
+    first += block.count;
+
+    if (is_nodes) {
+      const std::size_t tag_size = sizeof(std::size_t);
+      const std::size_t coord_size = (3 + (block.type ? block.entity_dim : 0)) * sizeof(double);
+      block.records = is_binary ? fixed_records(content, pos, block.count, tag_size)
+                                : text_records(content, pos, block.count);
+      pos = block.records.end;
+      block.coords = is_binary ? fixed_records(content, pos, block.count, coord_size)
+                               : text_records(content, pos, block.count);
+      pos = block.coords.end;
+    } else {
+      const std::size_t record_size = (1 + gmsh_nodes_per_cell(block.type)) * sizeof(std::size_t);
+      block.records = is_binary ? fixed_records(content, pos, block.count, record_size)
+                                : text_records(content, pos, block.count);
+      pos = block.records.end;
+    }
+    section.blocks.emplace_back(std::move(block));
+  }
+  return pos;
+}
+
+/// Size of a binary MSH 2.2 node record: an `int` tag followed by three coordinates.
+constexpr std::size_t legacy_node_size = sizeof(int) + 3 * sizeof(double);
+
+template <class T>
+T load(const char* src) {
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  return value;
+}
+
+/// Size of a binary MSH 2.2 element record: tag, `num_tags` tags and the node tags.
+std::size_t legacy_element_size(const BlockIndex& block) {
+  return (1 + block.num_tags + gmsh_nodes_per_cell(block.type)) * sizeof(int);
+}
+
+/// Text cursor over the lines of split `split` of `range`.
+TextCursor split_cursor(std::string_view content, const RecordRange& range, std::size_t split) {
+  const std::size_t last = split + 1 < range.splits.size() ? range.splits[split + 1] : range.end;
+  return {content.data() + range.splits[split], content.data() + last};
+}
+
+struct TagRange {
+  std::size_t min = std::numeric_limits<std::size_t>::max();
+  std::size_t max = 0;
+
+  void add(std::size_t tag) {
+    min = std::min(min, tag);
+    max = std::max(max, tag);
+  }
+};
+
+/// Indexes an MSH 2.2 `$Nodes` section as a single block of `tag x y z` records.
+std::size_t index_legacy_nodes(std::string_view content, SectionIndex& section, bool is_binary) {
+  TextCursor header(content.data() + section.begin, content.data() + content.size());
+  const auto count = header.next<std::size_t>();
+  std::size_t pos = next_line(content, header.position() - content.data());
+
+  BlockIndex block;
+  block.entity_dim = -1;
+  block.entity_tag = -1;
+  block.count = count;
+  block.header = section.begin;
+  block.legacy = true;
+  TagRange tags;
+  if (is_binary) {
+    block.records = fixed_records(content, pos, count, legacy_node_size);
+    std::vector<TagRange> split_tags(number_of_splits(block));
+    utils::parallel_for(split_tags.size(), [&](std::size_t s) {
+      const char* src = content.data() + pos + s * records_per_split * legacy_node_size;
+      for (std::size_t r = 0; r < split_size(block, s); ++r) {
+        split_tags[s].add(load<int>(src + r * legacy_node_size));
+      }
+    });
+    for (const auto& range : split_tags) {
+      tags.add(range.min);
+      tags.add(range.max);
+    }
+  } else {
+    block.records = {pos, pos, {}};
+    block.records.splits.reserve(count / records_per_split + 1);
+    for (std::size_t i = 0; i < count; ++i) {
+      if (pos >= content.size()) throw std::runtime_error("Invalid GMSH file: truncated");
+      if (i % records_per_split == 0) block.records.splits.push_back(pos);
+      const std::size_t eol = next_line(content, pos);
+      tags.add(TextCursor(content.data() + pos, content.data() + eol).next<std::size_t>());
+      pos = eol;
+    }
+    block.records.end = pos;
+  }
+  block.coords = block.records;
+  section.header = {1, count, count ? tags.min : 0, tags.max};
+  section.blocks.emplace_back(std::move(block));
+  return section.blocks.back().records.end;
+}
+
+/**
+ * Indexes an MSH 2.2 `$Elements` section, starting a new block whenever the element type, the
+ * physical tag or the elementary tag (the first and second tags of a record) changes.
+ */
+std::size_t index_legacy_elements(std::string_view content, SectionIndex& section,
+                                  bool is_binary) {
+  TextCursor header(content.data() + section.begin, content.data() + content.size());
+  const auto count = header.next<std::size_t>();
+  std::size_t pos = next_line(content, header.position() - content.data());
+
+  TagRange tags;
+  auto start_block = [&](int type, int physical_tag, int entity_tag, std::size_t first,
+                         std::size_t begin) {
+    BlockIndex block;
+    block.entity_dim = gmsh_celltype_to_oiseau_celltype(type)->dimension();
+    block.entity_tag = entity_tag;
+    block.physical_tag = physical_tag;
+    block.type = type;
+    block.first = first;
+    block.header = begin;
+    block.records = {begin, begin, {}};
+    block.legacy = true;
+    section.blocks.emplace_back(std::move(block));
+    return &section.blocks.back();
+  };
+
+  if (is_binary) {
+    std::size_t first = 0;
+    while (first < count) {
+      const int type = read_binary<int>(content, pos);
+      const auto n = static_cast<std::size_t>(read_binary<int>(content, pos));
+      const auto num_tags = static_cast<std::size_t>(read_binary<int>(content, pos));
+      const std::size_t record_size = (1 + num_tags + gmsh_nodes_per_cell(type)) * sizeof(int);
+      const auto run = fixed_records(content, pos, n, record_size);
+      BlockIndex* block = nullptr;
+      for (std::size_t r = 0; r < n; ++r) {
+        const char* record = content.data() + run.begin + r * record_size;
+        const int physical_tag = num_tags > 0 ? load<int>(record + sizeof(int)) : 0;
+        const int entity_tag = num_tags > 1 ? load<int>(record + 2 * sizeof(int)) : 0;
+        if (!block || block->entity_tag != entity_tag || block->physical_tag != physical_tag) {
+          block = start_block(type, physical_tag, entity_tag, first + r,
+                              run.begin + r * record_size);
+          block->num_tags = num_tags;
+        }
+        block->records.end += record_size;
+        ++block->count;
+        tags.add(load<int>(record));
+      }
+      pos = run.end;
+      first += n;
+    }
+  } else {
+    BlockIndex* block = nullptr;
+    for (std::size_t i = 0; i < count; ++i) {
+      if (pos >= content.size()) throw std::runtime_error("Invalid GMSH file: truncated");
+      const std::size_t eol = next_line(content, pos);
+      TextCursor line(content.data() + pos, content.data() + eol);
+      const auto tag = line.next<std::size_t>();
+      const int type = line.next<int>();
+      const auto num_tags = line.next<std::size_t>();
+      int physical_tag = 0;
+      int entity_tag = 0;
+      for (std::size_t t = 0; t < num_tags; ++t) {
+        const int value = line.next<int>();
+        if (t == 0) physical_tag = value;
+        if (t == 1) entity_tag = value;
+      }
+      if (!block || block->type != type || block->entity_tag != entity_tag ||
+          block->physical_tag != physical_tag) {
+        block = start_block(type, physical_tag, entity_tag, i, pos);
+      }
+      if (block->count % records_per_split == 0) block->records.splits.push_back(pos);
+      block->records.end = eol;
+      ++block->count;
+      tags.add(tag);
+      pos = eol;
+    }
+  }
+  section.header = {section.blocks.size(), count, count ? tags.min : 0, tags.max};
+  return pos;
+}
+
+/**
+ * Reads split `split` of an MSH 2.2 node block. Either output may be null; `coords` receives
+ * three values per node.
+ */
+void read_legacy_nodes(std::string_view content, const BlockIndex& block, std::size_t split,
+                       bool is_binary, std::size_t* tags, double* coords) {
+  const std::size_t n = split_size(block, split);
+  if (is_binary) {
+    const char* src =
+        content.data() + block.records.begin + split * records_per_split * legacy_node_size;
+    for (std::size_t r = 0; r < n; ++r, src += legacy_node_size) {
+      if (tags) tags[r] = load<int>(src);
+      if (coords) std::memcpy(coords + 3 * r, src + sizeof(int), 3 * sizeof(double));
+    }
+    return;
+  }
+  TextCursor cursor = split_cursor(content, block.records, split);
+  for (std::size_t r = 0; r < n; ++r) {
+    const auto tag = cursor.next<std::size_t>();
+    if (tags) tags[r] = tag;
+    if (!coords) {
+      cursor.skip_line();
+      continue;
+    }
+    for (std::size_t k = 0; k < 3; ++k) coords[3 * r + k] = cursor.next<double>();
+  }
+}
+
+/**
+ * Reads split `split` of an MSH 2.2 element block. Every record is written as the node tags
+ * minus `shift`, preceded by the element tag when `keep_tag` is set.
+ */
+void read_legacy_elements(std::string_view content, const BlockIndex& block, std::size_t split,
+                          bool is_binary, bool keep_tag, std::size_t shift, std::size_t* out) {
+  const std::size_t npc = gmsh_nodes_per_cell(block.type);
+  const std::size_t n = split_size(block, split);
+  if (is_binary) {
+    const std::size_t record_size = legacy_element_size(block);
+    const char* src = content.data() + block.records.begin;
+    src += split * records_per_split * record_size;
+    for (std::size_t r = 0; r < n; ++r, src += record_size) {
+      if (keep_tag) *out++ = load<int>(src);
+      const char* nodes = src + (1 + block.num_tags) * sizeof(int);
+      for (std::size_t k = 0; k < npc; ++k) *out++ = load<int>(nodes + k * sizeof(int)) - shift;
+    }
+    return;
+  }
+  TextCursor cursor = split_cursor(content, block.records, split);
+  for (std::size_t r = 0; r < n; ++r) {
+    const auto tag = cursor.next<std::size_t>();
+    if (keep_tag) *out++ = tag;
+    cursor.next<int>();
+    const auto num_tags = cursor.next<std::size_t>();
+    for (std::size_t t = 0; t < num_tags; ++t) cursor.next<int>();
+    for (std::size_t k = 0; k < npc; ++k) *out++ = cursor.next<std::size_t>() - shift;
+  }
+}
+
+/**
+ * Reads `n` records of `stride` values starting at split `split` of `range`, keeping the first
+ * `keep` values of every record.
+ */
+template <class T>
+void read_records(std::string_view content, const RecordRange& range, std::size_t split,
+                  std::size_t n, std::size_t stride, std::size_t keep, bool is_binary, T* out) {
+  if (is_binary) {
+    const std::size_t offset = split * records_per_split * stride * sizeof(T);
+    const char* src = content.data() + range.begin + offset;
+    if (keep == stride) {
+      std::memcpy(out, src, n * stride * sizeof(T));
+      return;
+    }
+    for (std::size_t r = 0; r < n; ++r) {
+      std::memcpy(out + r * keep, src + r * stride * sizeof(T), keep * sizeof(T));
+    }
+    return;
+  }
+  TextCursor cursor = split_cursor(content, range, split);
+  for (std::size_t r = 0; r < n; ++r) {
+    for (std::size_t k = 0; k < keep; ++k) *out++ = cursor.next<T>();
+    if (keep < stride) cursor.skip_line();
+  }
+}
+
+struct ParseJob {
+  std::size_t block;
+  std::size_t split;
+  bool coords;
+};
+
+}  // namespace
+
+const SectionIndex* FileIndex::find(std::string_view name) const {
+  auto it = std::ranges::find(sections, name, &SectionIndex::name);
+  return it == sections.end() ? nullptr : &*it;
+}
+
+FileIndex index_file(std::string_view content) {
+  FileIndex index;
+  bool has_format = false;
+  std::size_t pos = 0;
+  while (pos < content.size()) {
+    const std::size_t eol = next_line(content, pos);
+    const std::string_view line = trim(content.substr(pos, eol - pos));
+    pos = eol;
+    if (!line.starts_with(PREFIX)) continue;
+
+    SectionIndex section;
+    section.name = line.substr(1);
+    section.begin = pos;
+    std::size_t search_from = pos;
+    if (section.name == "MeshFormat") {
+      std::istringstream stream(std::string(content.substr(pos, 64)));
+      index.format = mesh_format_handler(stream);
+      has_format = true;
+    } else if (!has_format) {
+      throw std::runtime_error("Invalid GMSH file: missing $MeshFormat section");
+    } else if (section.name == "Nodes") {
+      search_from = index.format.is_legacy()
+                        ? index_legacy_nodes(content, section, index.format.is_binary)
+                        : index_blocks(content, section, index.format.is_binary, true);
+    } else if (section.name == "Elements") {
+      search_from = index.format.is_legacy()
+                        ? index_legacy_elements(content, section, index.format.is_binary)
+                        : index_blocks(content, section, index.format.is_binary, false);
+    }
+
+    const std::string end_marker = "$End" + section.name;
+    const std::size_t end = content.find(end_marker, search_from);
+    section.end = end == std::string_view::npos ? content.size() : end;
+    pos = next_line(content, section.end);
+    index.sections.emplace_back(std::move(section));
+  }
+  return index;
+}
+
+NodesSection parse_nodes(std::string_view content, const SectionIndex& section, bool is_binary) {
+  std::vector<NodesBlock> blocks;
+  std::vector<ParseJob> jobs;
+  blocks.reserve(section.blocks.size());
+  for (std::size_t b = 0; b < section.blocks.size(); ++b) {
+    const auto& block = section.blocks[b];
+    blocks.emplace_back(block.entity_dim, block.entity_tag, block.type, block.count,
+                        std::vector<std::size_t>(block.count),
+                        std::vector<double>(3 * block.count));
+    for (std::size_t s = 0; s < number_of_splits(block); ++s) {
+      jobs.push_back({b, s, false});
+      jobs.push_back({b, s, true});
+    }
+  }
+
+  utils::parallel_for(jobs.size(), [&](std::size_t j) {
+    const auto& job = jobs[j];
+    const auto& index = section.blocks[job.block];
+    auto& block = blocks[job.block];
+    const std::size_t first = job.split * records_per_split;
+    if (job.coords) {
+      read_node_coords(content, index, job.split, is_binary,
+                       block.node_coords.data() + 3 * first);
+    } else {
+      read_node_tags(content, index, job.split, is_binary, block.node_tags.data() + first);
+    }
+  });
+
+  const auto& [num_blocks, num_nodes, min_tag, max_tag] = section.header;
+  return {num_blocks, num_nodes, min_tag, max_tag, std::move(blocks)};
+}
+
+ElementSection parse_elements(std::string_view content, const SectionIndex& section,
+                              bool is_binary) {
+  std::vector<ElementBlock> blocks;
+  std::vector<ParseJob> jobs;
+  blocks.reserve(section.blocks.size());
+  for (std::size_t b = 0; b < section.blocks.size(); ++b) {
+    const auto& block = section.blocks[b];
+    const std::size_t record_size = 1 + gmsh_nodes_per_cell(block.type);
+    blocks.emplace_back(block.entity_dim, block.entity_tag, block.type, block.count,
+                        std::vector<std::size_t>(record_size * block.count));
+    if (block.legacy) blocks.back().physical_tag = block.physical_tag;
+    for (std::size_t s = 0; s < number_of_splits(block); ++s) jobs.push_back({b, s, false});
+  }
+
+  utils::parallel_for(jobs.size(), [&](std::size_t j) {
+    const auto& job = jobs[j];
+    const auto& index = section.blocks[job.block];
+    auto& block = blocks[job.block];
+    const std::size_t record_size = block.data.size() / std::max<std::size_t>(index.count, 1);
+    const std::size_t first = job.split * records_per_split;
+    read_element_records(content, index, job.split, is_binary,
+                         block.data.data() + record_size * first);
+  });
+
+  const auto& [num_blocks, num_elements, min_tag, max_tag] = section.header;
+  return {num_blocks, num_elements, min_tag, max_tag, std::move(blocks)};
+}
+
+void read_node_coords(std::string_view content, const BlockIndex& block, std::size_t split,
+                      bool is_binary, double* out) {
+  if (block.legacy) return read_legacy_nodes(content, block, split, is_binary, nullptr, out);
+  const std::size_t stride = 3 + (block.type ? block.entity_dim : 0);
+  read_records(content, block.coords, split, split_size(block, split), stride, 3, is_binary, out);
+}
+
+void read_node_tags(std::string_view content, const BlockIndex& block, std::size_t split,
+                    bool is_binary, std::size_t* out) {
+  if (block.legacy) return read_legacy_nodes(content, block, split, is_binary, out, nullptr);
+  read_records(content, block.records, split, split_size(block, split), 1, 1, is_binary, out);
+}
+
+void read_element_nodes(std::string_view content, const BlockIndex& block, std::size_t split,
+                        bool is_binary, std::size_t* out) {
+  if (block.legacy) return read_legacy_elements(content, block, split, is_binary, false, 1, out);
+  const std::size_t npc = gmsh_nodes_per_cell(block.type);
+  const std::size_t n = split_size(block, split);
+  if (is_binary) {
+    const std::size_t offset = split * records_per_split * (1 + npc) * sizeof(std::size_t);
+    copy_connectivity(content.data() + block.records.begin + offset, n, npc, out);
+    return;
+  }
+  TextCursor cursor = split_cursor(content, block.records, split);
+  for (std::size_t r = 0; r < n; ++r) {
+    cursor.next<std::size_t>();
+    for (std::size_t k = 0; k < npc; ++k) *out++ = cursor.next<std::size_t>() - 1;
+  }
+}
+
+void read_element_records(std::string_view content, const BlockIndex& block, std::size_t split,
+                          bool is_binary, std::size_t* out) {
+  if (block.legacy) return read_legacy_elements(content, block, split, is_binary, true, 0, out);
+  const std::size_t record_size = 1 + gmsh_nodes_per_cell(block.type);
+  read_records(content, block.records, split, split_size(block, split), record_size, record_size,
+               is_binary, out);
+}
+
+void copy_connectivity(const char* records, std::size_t count, std::size_t npc,
+                       std::size_t* conn) {
+  const std::size_t record_size = (1 + npc) * sizeof(std::size_t);
+  for (std::size_t i = 0; i < count; ++i) {
+    std::memcpy(conn + i * npc, records + i * record_size + sizeof(std::size_t),
+                npc * sizeof(std::size_t));
+  }
+  for (std::size_t j = 0; j < count * npc; ++j) conn[j] -= 1;
+}
+
+NodeTagMap::NodeTagMap(std::span<const std::size_t> tags, std::size_t min_tag,
+                       std::size_t max_tag)
+    : m_min_tag(min_tag) {
+  std::atomic<bool> identity = true;
+  utils::parallel_for(
+      tags.size(),
+      [&](std::size_t i) {
+        if (tags[i] != i + 1) identity.store(false, std::memory_order_relaxed);
+      },
+      records_per_split);
+  m_identity = identity;
+  if (m_identity) return;
+
+  if (min_tag > max_tag) throw std::runtime_error("Invalid GMSH file: bad node tag range");
+  const std::size_t range = max_tag - min_tag + 1;
+  auto duplicate = [](std::size_t tag) {
+    return std::runtime_error("Invalid GMSH file: duplicate node tag " + std::to_string(tag));
+  };
+  if (range / 4 <= tags.size()) {
+    // Slots are claimed atomically, so a tag listed twice is caught whichever job sees it last.
+    m_dense.assign(range, npos);
+    utils::parallel_for(
+        tags.size(),
+        [&](std::size_t i) {
+          if (tags[i] < min_tag || tags[i] > max_tag) {
+            throw std::runtime_error("Invalid GMSH file: node tag outside declared range");
+          }
+          std::size_t expected = npos;
+          if (!std::atomic_ref(m_dense[tags[i] - min_tag])
+                   .compare_exchange_strong(expected, i, std::memory_order_relaxed)) {
+            throw duplicate(tags[i]);
+          }
+        },
+        records_per_split);
+    return;
+  }
+  m_sparse.reserve(tags.size());
+  for (std::size_t i = 0; i < tags.size(); ++i) {
+    if (!m_sparse.emplace(tags[i], i).second) throw duplicate(tags[i]);
+  }
+}
+
+std::size_t NodeTagMap::operator()(std::size_t tag) const {
+  if (m_identity) return tag - 1;
+  if (m_sparse.empty()) {
+    const std::size_t i = tag >= m_min_tag && tag - m_min_tag < m_dense.size()
+                              ? m_dense[tag - m_min_tag]
+                              : npos;
+    if (i != npos) return i;
+  } else if (auto it = m_sparse.find(tag); it != m_sparse.end()) {
+    return it->second;
+  }
+  throw std::runtime_error("Invalid GMSH file: unknown node tag " + std::to_string(tag));
+}
+
+void NodeTagMap::remap(std::span<std::size_t> conn) const {
+  if (m_identity) return;
+  utils::parallel_for(
+      conn.size(), [&](std::size_t j) { conn[j] = (*this)(conn[j] + 1); }, records_per_split);
+}
+
+std::string read_all(std::istream& f_handler, std::size_t size_hint) {
+  std::string content;
+  const auto start = f_handler.tellg();
+  if (start != std::istream::pos_type(-1) && f_handler.seekg(0, std::ios::end)) {
+    const auto end = f_handler.tellg();
+    f_handler.seekg(start);
+    content.resize(static_cast<std::size_t>(end - start));
+    f_handler.read(content.data(), static_cast<std::streamsize>(content.size()));
+    content.resize(static_cast<std::size_t>(f_handler.gcount()));
+    return content;
+  }
+  // Unseekable streams (pipes, decompressors) are read in doubling blocks, starting from the
+  // producer's size estimate so that an exact hint needs no reallocation.
+  f_handler.clear();
+  constexpr std::size_t min_block = std::size_t{1} << 16;
+  content.resize(std::max(size_hint, min_block));
+  std::size_t size = 0;
+  while (true) {
+    f_handler.read(content.data() + size, static_cast<std::streamsize>(content.size() - size));
+    size += static_cast<std::size_t>(f_handler.gcount());
+    if (size < content.size() || f_handler.peek() == std::istream::traits_type::eof()) break;
+    content.resize(2 * content.size());
+  }
+  content.resize(size);
+  return content;
+}
+
+}  // namespace oiseau::io::detail
@@ -0,0 +1,193 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "oiseau/io/gmsh_file.hpp"
+
+/**
+ * @file gmsh_index.hpp
+ * @brief Two-phase reader for in-memory MSH 4.1 and MSH 2.2 files.
+ *
+ * The first phase (`index_file`) locates every section and, for `$Nodes` and `$Elements`, the
+ * byte range of every entity block. Binary blocks are skipped using their known sizes; ASCII
+ * blocks are skipped line by line while recording a split point every `records_per_split`
+ * records. The second phase (`parse_nodes`, `parse_elements`) turns every split of every block
+ * into an independent job and runs the jobs concurrently on the default thread pool.
+ *
+ * MSH 2.2 files have no entity blocks: their nodes are indexed as a single block, and their
+ * elements as one block per run of consecutive elements sharing a type, an elementary (entity)
+ * tag and a physical tag. Such blocks are flagged `legacy` and read with the 2.2 record layout,
+ * so both versions feed the same second phase.
+ */
+
+namespace oiseau::io::detail {
+
+/// Number of records (lines in ASCII mode) handled by a single parse job.
+inline constexpr std::size_t records_per_split = std::size_t{1} << 14;
+
+/**
+ * @brief Byte range holding a run of fixed-layout records.
+ *
+ * In ASCII mode `splits` holds the offset of every `records_per_split`-th record, starting with
+ * `begin`, so that the range can be cut at line boundaries without rescanning it.
+ */
+struct RecordRange {
+  std::size_t begin{};
+  std::size_t end{};
+  std::vector<std::size_t> splits{};
+};
+
+/// Location and header of a single `NodesBlock` or `ElementBlock`.
+struct BlockIndex {
+  int entity_dim{};
+  int entity_tag{};
+  int type{};               ///< Element type, or the parametric flag of a node block.
+  std::size_t count{};      ///< Number of nodes or elements in the block.
+  std::size_t first{};      ///< Index of the first node or element within the section.
+  std::size_t header{};     ///< Offset of the block header.
+  RecordRange records{};    ///< Node tags, or element records (tag followed by node tags).
+  RecordRange coords{};     ///< Node coordinates; empty for element blocks.
+  /**
+   * MSH 2.2 layout: node records interleave the tag with the coordinates (`records` and
+   * `coords` are the same range), element records hold the element tag, type and tags before
+   * the node tags, and binary values are 32-bit integers.
+   */
+  bool legacy{};
+  std::size_t num_tags{};   ///< Tags per element record of a binary MSH 2.2 block.
+  int physical_tag{};       ///< Physical group of an MSH 2.2 element block (its first tag).
+};
+
+/// Location of a `$Name` ... `$EndName` section. `begin` is the first byte after `$Name`.
+struct SectionIndex {
+  std::string name;
+  std::size_t begin{};
+  std::size_t end{};
+  std::array<std::size_t, 4> header{};  ///< Section header of `$Nodes` and `$Elements`.
+  std::vector<BlockIndex> blocks{};
+
+  inline std::string_view body(std::string_view content) const {
+    return content.substr(begin, end - begin);
+  }
+};
+
+struct FileIndex {
+  MeshFormatSection format{};
+  std::vector<SectionIndex> sections{};
+
+  /// Returns the first section called `name`, or nullptr.
+  const SectionIndex* find(std::string_view name) const;
+};
+
+/// Phase one: locates sections and entity blocks of an in-memory MSH 4.1 or 2.2 file.
+FileIndex index_file(std::string_view content);
+
+/// Phase two: parses an indexed `$Nodes` section concurrently.
+NodesSection parse_nodes(std::string_view content, const SectionIndex& section, bool is_binary);
+
+/// Phase two: parses an indexed `$Elements` section concurrently.
+ElementSection parse_elements(std::string_view content, const SectionIndex& section,
+                              bool is_binary);
+
+/// Number of independent parse jobs `block` is cut into.
+inline std::size_t number_of_splits(const BlockIndex& block) {
+  return (block.count + records_per_split - 1) / records_per_split;
+}
+
+/// Number of records held by split `split` of `block`.
+inline std::size_t split_size(const BlockIndex& block, std::size_t split) {
+  return std::min(block.count - split * records_per_split, records_per_split);
+}
+
+/**
+ * @brief Reads the coordinates of split `split` of a node block into `out`.
+ *
+ * Writes three values per node; the parametric coordinates of parametric blocks are dropped.
+ */
+void read_node_coords(std::string_view content, const BlockIndex& block, std::size_t split,
+                      bool is_binary, double* out);
+
+/// Reads the tags of split `split` of a node block into `out`.
+void read_node_tags(std::string_view content, const BlockIndex& block, std::size_t split,
+                    bool is_binary, std::size_t* out);
+
+/**
+ * @brief Reads the node tags of split `split` of an element block into `out`.
+ *
+ * Element tags are dropped and node tags are shifted to 0-based indices, so `out` receives
+ * `gmsh_nodes_per_cell(block.type)` entries per element, ready to be used as CSR connectivity.
+ */
+void read_element_nodes(std::string_view content, const BlockIndex& block, std::size_t split,
+                        bool is_binary, std::size_t* out);
+
+/**
+ * @brief Reads split `split` of an element block as whole records into `out`.
+ *
+ * Every record is the element tag followed by its `gmsh_nodes_per_cell(block.type)` node tags,
+ * all as written in the file.
+ */
+void read_element_records(std::string_view content, const BlockIndex& block, std::size_t split,
+                          bool is_binary, std::size_t* out);
+
+/**
+ * @brief Copies `count` gmsh element records into CSR connectivity.
+ *
+ * Every record holds the element tag followed by `npc` 1-based node tags; the tags are copied
+ * in bulk to `conn` and shifted to 0-based indices in a separate vectorizable pass.
+ */
+void copy_connectivity(const char* records, std::size_t count, std::size_t npc,
+                       std::size_t* conn);
+
+/**
+ * @class NodeTagMap
+ * @brief Maps (possibly sparse) gmsh node tags to 0-based node indices.
+ *
+ * Node `i` of the mesh is the `i`-th node listed in `$Nodes`, whatever its tag. When the tags
+ * are exactly `1..n` in file order the map is the identity and remapping is skipped. Otherwise
+ * a dense lookup table over `[min_tag, max_tag]` is used when at least a quarter of that range
+ * is occupied, and a hash map when the tags are too scattered for a table. A tag listed twice
+ * throws `std::runtime_error`.
+ */
+class NodeTagMap {
+ public:
+  NodeTagMap(std::span<const std::size_t> tags, std::size_t min_tag, std::size_t max_tag);
+
+  inline bool is_identity() const { return m_identity; }
+  inline bool is_dense() const { return !m_identity && m_sparse.empty(); }
+
+  /// Returns the node index of `tag`; throws `std::runtime_error` for unknown tags.
+  std::size_t operator()(std::size_t tag) const;
+
+  /**
+   * @brief Remaps connectivity in place, in parallel.
+   *
+   * `conn` holds shifted tags (`tag - 1`), as produced by `read_element_nodes`.
+   */
+  void remap(std::span<std::size_t> conn) const;
+
+ private:
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  bool m_identity = true;
+  std::size_t m_min_tag = 0;
+  std::vector<std::size_t> m_dense{};
+  std::unordered_map<std::size_t, std::size_t> m_sparse{};
+};
+
+/// Reads the remainder of a stream into memory; `size_hint` pre-sizes unseekable reads.
+std::string read_all(std::istream& f_handler, std::size_t size_hint = 0);
+
+}  // namespace oiseau::io::detail
@@ -0,0 +1,300 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <initializer_list>
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "oiseau/io/gmsh.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/utils/thread_pool.hpp"
+
+namespace oiseau::io {
+
+namespace {
+
+/// Number of records formatted by a single job.
+constexpr std::size_t records_per_chunk = std::size_t{1} << 14;
+
+/// Appends values in the ASCII or binary encoding of MSH 4.1.
+class RecordFormatter {
+ public:
+  RecordFormatter(std::string& out, bool binary) : m_out(out), m_binary(binary) {}
+
+  template <class T>
+  void value(T v) {
+    if (m_binary) {
+      m_out.append(reinterpret_cast<const char*>(&v), sizeof(T));
+      return;
+    }
+    char buffer[32];
+    auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), v);
+    m_out.append(buffer, ptr);
+    m_out.push_back(' ');
+  }
+
+  void end_record() {
+    if (m_binary) return;
+    m_out.back() = '\n';
+  }
+
+ private:
+  std::string& m_out;
+  bool m_binary;
+};
+
+/// An element block: a run of consecutive cells sharing one cell type and geometry order.
+struct CellRun {
+  std::size_t first;
+  std::size_t count;
+  oiseau::mesh::CellType cell_type;
+  unsigned order;
+  int entity_tag = 1;
+};
+
+class GMSHWriter {
+ public:
+  GMSHWriter(const std::filesystem::path& path, bool binary)
+      : m_out(path, std::ios::binary), m_binary(binary) {
+    if (!m_out) throw std::runtime_error("Could not open file for writing: " + path.string());
+  }
+
+  void write(const oiseau::mesh::Mesh& mesh) {
+    const auto& topology = mesh.topology();
+    const auto& conn = topology.conn();
+    const auto cell_types = topology.cell_types();
+    const auto x = mesh.geometry().x();
+    const std::size_t gdim = mesh.geometry().dim();
+    const std::size_t n_nodes = gdim ? x.size() / gdim : 0;
+    const std::size_t n_cells = topology.n_cells();
+    const auto& high_order_nodes = mesh.geometry().high_order_nodes();
+    const bool high_order = high_order_nodes.num_rows() > 0;
+
+    // Cells with attributes keep their entity and its physical group; otherwise they all go to
+    // entity 1.
+    const auto entity_tags = topology.entity_tags();
+    const auto physical_tags = topology.physical_tags();
+    std::map<int, std::int32_t> cell_entities;
+    std::vector<CellRun> runs;
+    int tdim = 0;
+    for (std::size_t i = 0; i < n_cells; ++i) {
+      const auto kind = cell_types[i]->kind();
+      const std::size_t n = conn[i].size() + (high_order ? high_order_nodes[i].size() : 0);
+      const unsigned order = oiseau::mesh::geometry_order(kind, n);
+      const int entity = entity_tags.empty() ? 1 : entity_tags[i];
+      if (!entity_tags.empty()) {
+        cell_entities.try_emplace(entity, physical_tags.empty() ? 0 : physical_tags[i]);
+      }
+      tdim = std::max(tdim, cell_types[i]->dimension());
+      if (!runs.empty() && runs.back().cell_type->kind() == kind && runs.back().order == order &&
+          runs.back().entity_tag == entity) {
+        ++runs.back().count;
+      } else {
+        runs.push_back({i, 1, cell_types[i], order, entity});
+      }
+    }
+    if (n_cells && cell_entities.empty()) cell_entities.emplace(1, 0);
+
+    // Facets go to entities of their own dimension, one per physical group, so that reading
+    // the file back restores the facet table.
+    const auto& facets = topology.facets();
+    std::map<std::pair<int, std::int32_t>, int> facet_entities;
+    std::vector<CellRun> facet_runs;
+    for (std::size_t i = 0; i < facets.size(); ++i) {
+      const auto cell_type = facets.cell_types[i];
+      const auto key = std::pair{cell_type->dimension(), facets.physical_tags[i]};
+      const int entity = facet_entities.try_emplace(key, 2 + facet_entities.size()).first->second;
+      if (!facet_runs.empty() && facet_runs.back().cell_type == cell_type &&
+          facet_runs.back().entity_tag == entity) {
+        ++facet_runs.back().count;
+      } else {
+        facet_runs.push_back({i, 1, cell_type, 1, entity});
+      }
+    }
+    const std::size_t n_elements = n_cells + facets.size();
+
+    text(m_binary ? "$MeshFormat\n4.1 1 8\n" : "$MeshFormat\n4.1 0 8\n");
+    if (m_binary) {
+      const int one = 1;
+      raw(&one, 1);
+      text("\n");
+    }
+    text("$EndMeshFormat\n");
+    if (!facet_entities.empty() || !entity_tags.empty()) {
+      std::string out;
+      RecordFormatter f(out, m_binary);
+      std::array<std::size_t, 4> counts{};
+      counts[tdim] += cell_entities.size();
+      for (const auto& [key, tag] : facet_entities) ++counts[key.first];
+      for (std::size_t count : counts) f.value(count);
+      f.end_record();
+      auto entity = [&](int dim, int tag, std::int32_t physical) {
+        f.value(tag);
+        for (int k = 0; k < (dim == 0 ? 3 : 6); ++k) f.value(0.0);
+        f.value(static_cast<std::size_t>(physical != 0));
+        if (physical != 0) f.value(static_cast<int>(physical));
+        if (dim > 0) f.value(std::size_t{0});
+        f.end_record();
+      };
+      for (int dim = 0; dim < 4; ++dim) {
+        if (dim == tdim) {
+          for (const auto& [tag, physical] : cell_entities) entity(dim, tag, physical);
+        }
+        for (const auto& [key, tag] : facet_entities) {
+          if (key.first == dim) entity(dim, tag, key.second);
+        }
+      }
+      text("$Entities\n");
+      text(out);
+      text(m_binary ? "\n$EndEntities\n" : "$EndEntities\n");
+    }
+    text("$Nodes\n");
+    header({n_nodes ? 1u : 0u, n_nodes, n_nodes ? 1u : 0u, n_nodes});
+    if (n_nodes) {
+      block_header(tdim, cell_entities.empty() ? 1 : cell_entities.begin()->first, 0, n_nodes);
+      records(n_nodes, [](RecordFormatter& f, std::size_t i) {
+        f.value(i + 1);
+        f.end_record();
+      });
+      if (m_binary && gdim == 3) {
+        raw(x.data(), x.size());
+      } else {
+        records(n_nodes, [&](RecordFormatter& f, std::size_t i) {
+          for (std::size_t d = 0; d < 3; ++d) f.value(d < gdim ? x[i * gdim + d] : 0.0);
+          f.end_record();
+        });
+      }
+    }
+    text(m_binary ? "\n$EndNodes\n$Elements\n" : "$EndNodes\n$Elements\n");
+    header({runs.size() + facet_runs.size(), n_elements, n_elements ? 1u : 0u, n_elements});
+    for (const auto& run : runs) {
+      const int type = detail::oiseau_celltype_to_gmsh_celltype(run.cell_type, run.order);
+      block_header(run.cell_type->dimension(), run.entity_tag, type, run.count);
+      records(run.count, [&](RecordFormatter& f, std::size_t i) {
+        f.value(run.first + i + 1);
+        for (std::size_t node : conn[run.first + i]) f.value(node + 1);
+        if (high_order) {
+          for (std::size_t node : high_order_nodes[run.first + i]) f.value(node + 1);
+        }
+        f.end_record();
+      });
+    }
+    for (const auto& run : facet_runs) {
+      const int type = detail::oiseau_celltype_to_gmsh_celltype(run.cell_type, run.order);
+      block_header(run.cell_type->dimension(), run.entity_tag, type, run.count);
+      records(run.count, [&](RecordFormatter& f, std::size_t i) {
+        f.value(n_cells + run.first + i + 1);
+        for (std::size_t node : facets.conn[run.first + i]) f.value(node + 1);
+        f.end_record();
+      });
+    }
+    text(m_binary ? "\n$EndElements\n" : "$EndElements\n");
+
+    m_out.flush();
+    if (!m_out) throw std::runtime_error("Failed writing Gmsh file");
+  }
+
+ private:
+  void text(std::string_view s) { m_out.write(s.data(), static_cast<std::streamsize>(s.size())); }
+
+  template <class T>
+  void raw(const T* data, std::size_t n) {
+    m_out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(n * sizeof(T)));
+  }
+
+  void header(std::initializer_list<std::size_t> values) {
+    std::string out;
+    RecordFormatter f(out, m_binary);
+    for (std::size_t v : values) f.value(v);
+    f.end_record();
+    text(out);
+  }
+
+  void block_header(int entity_dim, int entity_tag, int type, std::size_t count) {
+    std::string out;
+    RecordFormatter f(out, m_binary);
+    f.value(entity_dim);
+    f.value(entity_tag);
+    f.value(type);
+    f.value(count);
+    f.end_record();
+    text(out);
+  }
+
+  /**
+   * Formats `n` records concurrently, in chunks of `records_per_chunk`, and writes the chunks
+   * in order. At most a bounded batch of chunks is held in memory at a time.
+   */
+  template <class Format>
+  void records(std::size_t n, Format&& format) {
+    const std::size_t n_chunks = (n + records_per_chunk - 1) / records_per_chunk;
+    const std::size_t batch = 4 * std::max<std::size_t>(utils::default_thread_pool().size(), 1);
+    std::vector<std::string> chunks(std::min(batch, n_chunks));
+    for (std::size_t c0 = 0; c0 < n_chunks; c0 += batch) {
+      const std::size_t m = std::min(batch, n_chunks - c0);
+      utils::parallel_for(m, [&](std::size_t c) {
+        std::string& out = chunks[c];
+        out.clear();
+        RecordFormatter f(out, m_binary);
+        const std::size_t begin = (c0 + c) * records_per_chunk;
+        const std::size_t end = std::min(n, begin + records_per_chunk);
+        for (std::size_t i = begin; i < end; ++i) format(f, i);
+      });
+      for (std::size_t c = 0; c < m; ++c) text(chunks[c]);
+    }
+  }
+
+  std::ofstream m_out;
+  bool m_binary;
+};
+
+}  // namespace
+
+void gmsh_write(const std::filesystem::path& path, const oiseau::mesh::Mesh& mesh,
+                const GMSHWriteOptions& options) {
+  GMSHWriter(path, options.binary).write(mesh);
+}
+
+void gmsh_write_partitions(std::span<const std::filesystem::path> paths,
+                           std::span<const oiseau::mesh::Mesh> partitions,
+                           const GMSHWriteOptions& options) {
+  if (paths.size() != partitions.size()) {
+    throw std::invalid_argument("gmsh_write_partitions: one path per partition is required");
+  }
+  auto& pool = utils::default_thread_pool();
+  std::vector<std::future<void>> futures;
+  futures.reserve(paths.size());
+  for (std::size_t p = 0; p < paths.size(); ++p) {
+    futures.push_back(pool.submit([&, p] { gmsh_write(paths[p], partitions[p], options); }));
+  }
+  std::exception_ptr error;
+  for (auto& future : futures) {
+    try {
+      pool.wait(future);
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace oiseau::io
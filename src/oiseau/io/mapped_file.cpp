@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+namespace oiseau::io::detail {
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Could not open file: " + path.string());
+  struct stat info {};
+  if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    ::close(fd);
+    throw std::runtime_error("Could not map file: " + path.string());
+  }
+  m_size = static_cast<std::size_t>(info.st_size);
+  if (m_size > 0) {
+    void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      ::close(fd);
+      throw std::runtime_error("Could not map file: " + path.string());
+    }
+    ::madvise(data, m_size, MADV_WILLNEED);
+    m_data = static_cast<const char*>(data);
+  }
+  ::close(fd);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    unmap();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+void MappedFile::release(std::size_t begin, std::size_t end) const {
+  if (!m_data) return;
+  const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  begin = (begin + page - 1) / page * page;
+  end = std::min(end, m_size) / page * page;
+  if (begin >= end) return;
+  ::madvise(const_cast<char*>(m_data) + begin, end - begin, MADV_DONTNEED);
+}
+
+void MappedFile::unmap() {
+  if (m_data) ::munmap(const_cast<char*>(m_data), m_size);
+  m_data = nullptr;
+  m_size = 0;
+}
+
+}  // namespace oiseau::io::detail
@@ -0,0 +1,45 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace oiseau::io::detail {
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The mapped pages belong to the page cache rather than to the process heap, so readers that
+ * parse straight out of `view()` never hold a private copy of the raw file. Ranges that have
+ * been consumed can be handed back to the kernel with `release`.
+ */
+class MappedFile {
+ public:
+  /// Maps `path`; throws `std::runtime_error` if the file cannot be opened or mapped.
+  explicit MappedFile(const std::filesystem::path& path);
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  inline std::string_view view() const { return {m_data, m_size}; }
+
+  /// Drops the pages fully contained in `[begin, end)` from the process' resident set.
+  void release(std::size_t begin, std::size_t end) const;
+
+ private:
+  void unmap();
+
+  const char* m_data = nullptr;
+  std::size_t m_size = 0;
+};
+
+}  // namespace oiseau::io::detail
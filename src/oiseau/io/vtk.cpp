@@ -0,0 +1,269 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/vtk.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "oiseau/io/xml.hpp"
+#include "oiseau/mesh/cell.hpp"
+
+namespace oiseau::io::detail {
+
+namespace {
+
+/// Integer coordinates of the points of a Lagrange cell, on the lattice {0, ..., order}^3.
+using Lattice = std::vector<std::array<int, 3>>;
+
+/**
+ * Appends the order-`n` triangle with corner (o, o) at height k in VTK order: vertices, edges,
+ * then the interior points as a triangle of order n - 3, recursively.
+ */
+void triangle_lattice(int n, int o, int k, Lattice& out) {
+  if (n < 0) return;
+  if (n == 0) {
+    out.push_back({o, o, k});
+    return;
+  }
+  out.insert(out.end(), {{o, o, k}, {o + n, o, k}, {o, o + n, k}});
+  for (int t = 1; t < n; ++t) out.push_back({o + t, o, k});
+  for (int t = 1; t < n; ++t) out.push_back({o + n - t, o + t, k});
+  for (int t = 1; t < n; ++t) out.push_back({o, o + n - t, k});
+  triangle_lattice(n - 3, o + 1, k, out);
+}
+
+void quadrilateral_lattice(int n, Lattice& out) {
+  out.insert(out.end(), {{0, 0, 0}, {n, 0, 0}, {n, n, 0}, {0, n, 0}});
+  for (int i = 1; i < n; ++i) out.push_back({i, 0, 0});
+  for (int j = 1; j < n; ++j) out.push_back({n, j, 0});
+  for (int i = 1; i < n; ++i) out.push_back({i, n, 0});
+  for (int j = 1; j < n; ++j) out.push_back({0, j, 0});
+  for (int j = 1; j < n; ++j)
+    for (int i = 1; i < n; ++i) out.push_back({i, j, 0});
+}
+
+/// Recursive like the triangle: the interior is a tetrahedron of order n - 4 with corner o.
+void tetrahedron_lattice(int n, int o, Lattice& out) {
+  if (n < 0) return;
+  if (n == 0) {
+    out.push_back({o, o, o});
+    return;
+  }
+  constexpr std::array<std::array<int, 3>, 4> v = {{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
+  constexpr std::array<std::array<int, 2>, 6> edges = {
+      {{0, 1}, {1, 2}, {2, 0}, {0, 3}, {1, 3}, {2, 3}}};
+  // Face vertices in the order that maps onto the vertices of the face triangle.
+  constexpr std::array<std::array<int, 3>, 4> faces = {
+      {{0, 1, 3}, {2, 3, 1}, {0, 3, 2}, {0, 2, 1}}};
+  auto point = [&](std::array<int, 3> w, std::array<int, 3> c) {
+    std::array<int, 3> p = {o, o, o};
+    for (int a = 0; a < 3; ++a) {
+      for (int d = 0; d < 3; ++d) p[d] += w[a] * v[c[a]][d];
+    }
+    return p;
+  };
+  for (int a = 0; a < 4; ++a) out.push_back(point({n, 0, 0}, {a, a, a}));
+  for (const auto& [a, b] : edges) {
+    for (int t = 1; t < n; ++t) out.push_back(point({n - t, t, 0}, {a, b, b}));
+  }
+  if (n >= 3) {
+    Lattice face;
+    triangle_lattice(n - 3, 0, 0, face);
+    for (const auto& f : faces) {
+      for (const auto& [p, q, unused] : face) {
+        out.push_back(point({n - 2 - p - q, 1 + p, 1 + q}, f));
+      }
+    }
+  }
+  tetrahedron_lattice(n - 4, o + 1, out);
+}
+
+void hexahedron_lattice(int n, Lattice& out) {
+  for (int k : {0, n}) out.insert(out.end(), {{0, 0, k}, {n, 0, k}, {n, n, k}, {0, n, k}});
+  for (int k : {0, n}) {
+    for (int i = 1; i < n; ++i) out.push_back({i, 0, k});
+    for (int j = 1; j < n; ++j) out.push_back({n, j, k});
+    for (int i = 1; i < n; ++i) out.push_back({i, n, k});
+    for (int j = 1; j < n; ++j) out.push_back({0, j, k});
+  }
+  for (const auto& [i, j] : std::array<std::array<int, 2>, 4>{{{0, 0}, {n, 0}, {n, n}, {0, n}}}) {
+    for (int k = 1; k < n; ++k) out.push_back({i, j, k});
+  }
+  for (int i : {0, n})
+    for (int k = 1; k < n; ++k)
+      for (int j = 1; j < n; ++j) out.push_back({i, j, k});
+  for (int j : {0, n})
+    for (int k = 1; k < n; ++k)
+      for (int i = 1; i < n; ++i) out.push_back({i, j, k});
+  for (int k : {0, n})
+    for (int j = 1; j < n; ++j)
+      for (int i = 1; i < n; ++i) out.push_back({i, j, k});
+  for (int k = 1; k < n; ++k)
+    for (int j = 1; j < n; ++j)
+      for (int i = 1; i < n; ++i) out.push_back({i, j, k});
+}
+
+void prism_lattice(int n, Lattice& out) {
+  for (int k : {0, n}) out.insert(out.end(), {{0, 0, k}, {n, 0, k}, {0, n, k}});
+  for (int k : {0, n}) {
+    for (int t = 1; t < n; ++t) out.push_back({t, 0, k});
+    for (int t = 1; t < n; ++t) out.push_back({n - t, t, k});
+    for (int t = 1; t < n; ++t) out.push_back({0, n - t, k});
+  }
+  for (const auto& [i, j] : std::array<std::array<int, 2>, 3>{{{0, 0}, {n, 0}, {0, n}}}) {
+    for (int k = 1; k < n; ++k) out.push_back({i, j, k});
+  }
+  for (int k : {0, n}) triangle_lattice(n - 3, 1, k, out);
+  for (int k = 1; k < n; ++k)
+    for (int t = 1; t < n; ++t) out.push_back({t, 0, k});
+  for (int k = 1; k < n; ++k)
+    for (int t = 1; t < n; ++t) out.push_back({n - t, t, k});
+  for (int k = 1; k < n; ++k)
+    for (int t = 1; t < n; ++t) out.push_back({0, t, k});
+  for (int k = 1; k < n; ++k) triangle_lattice(n - 3, 1, k, out);
+}
+
+}  // namespace
+
+std::uint8_t vtk_lagrange_cell_type(oiseau::mesh::CellKind kind) {
+  using oiseau::mesh::CellKind;
+  switch (kind) {
+  case CellKind::Point:
+    return 1;  // VTK_VERTEX
+  case CellKind::Interval:
+    return 68;  // VTK_LAGRANGE_CURVE
+  case CellKind::Triangle:
+    return 69;  // VTK_LAGRANGE_TRIANGLE
+  case CellKind::Quadrilateral:
+    return 70;  // VTK_LAGRANGE_QUADRILATERAL
+  case CellKind::Tetrahedron:
+    return 71;  // VTK_LAGRANGE_TETRAHEDRON
+  case CellKind::Hexahedron:
+    return 72;  // VTK_LAGRANGE_HEXAHEDRON
+  case CellKind::Prism:
+    return 73;  // VTK_LAGRANGE_WEDGE
+  case CellKind::Pyramid:
+    return 74;  // VTK_LAGRANGE_PYRAMID
+  default:
+    throw std::runtime_error("Unsupported cell type for VTK output");
+  }
+}
+
+std::vector<double> vtk_lagrange_nodes(oiseau::mesh::CellKind kind, unsigned order) {
+  using oiseau::mesh::CellKind;
+  if (order == 0) throw std::invalid_argument("Order must be greater than 0");
+  const int n = static_cast<int>(order);
+  Lattice lattice;
+  int dim = 3;
+  switch (kind) {
+  case CellKind::Interval:
+    dim = 1;
+    lattice.insert(lattice.end(), {{0, 0, 0}, {n, 0, 0}});
+    for (int i = 1; i < n; ++i) lattice.push_back({i, 0, 0});
+    break;
+  case CellKind::Triangle:
+    dim = 2;
+    triangle_lattice(n, 0, 0, lattice);
+    break;
+  case CellKind::Quadrilateral:
+    dim = 2;
+    quadrilateral_lattice(n, lattice);
+    break;
+  case CellKind::Tetrahedron:
+    tetrahedron_lattice(n, 0, lattice);
+    break;
+  case CellKind::Hexahedron:
+    hexahedron_lattice(n, lattice);
+    break;
+  case CellKind::Prism:
+    prism_lattice(n, lattice);
+    break;
+  default:
+    throw std::runtime_error("Unsupported cell type for VTK Lagrange output");
+  }
+  std::vector<double> nodes;
+  nodes.reserve(lattice.size() * dim);
+  for (const auto& p : lattice) {
+    for (int d = 0; d < dim; ++d) nodes.push_back(-1.0 + 2.0 * p[d] / n);
+  }
+  return nodes;
+}
+
+void write_vtu(const std::filesystem::path& path, const VTUGrid& grid) {
+  if (grid.points.size() % 3 != 0 || grid.offsets.size() != grid.types.size()) {
+    throw std::invalid_argument("write_vtu: inconsistent grid arrays");
+  }
+  const std::size_t n_points = grid.points.size() / 3;
+  for (const auto& field : grid.point_data) {
+    if (field.components == 0 || field.values.size() != n_points * field.components) {
+      throw std::invalid_argument("write_vtu: field '" + field.name +
+                                  "' does not match the number of points");
+    }
+  }
+
+  // Each appended array is a UInt64 byte count followed by the raw values.
+  struct Block {
+    const void* data;
+    std::uint64_t bytes;
+  };
+  std::vector<Block> blocks;
+  std::uint64_t offset = 0;
+  std::string xml;
+  auto data_array = [&](std::string_view type, std::string_view attributes, const void* data,
+                        std::uint64_t bytes) {
+    xml += "        <DataArray type=\"" + std::string(type) + "\" " + std::string(attributes) +
+           " format=\"appended\" offset=\"" + std::to_string(offset) + "\"/>\n";
+    blocks.push_back({data, bytes});
+    offset += sizeof(std::uint64_t) + bytes;
+  };
+
+  xml += "<?xml version=\"1.0\"?>\n";
+  xml += "<VTKFile type=\"UnstructuredGrid\" version=\"2.2\" byte_order=\"";
+  xml += std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian";
+  xml += "\" header_type=\"UInt64\">\n  <UnstructuredGrid>\n";
+  xml += "    <Piece NumberOfPoints=\"" + std::to_string(n_points) + "\" NumberOfCells=\"" +
+         std::to_string(grid.types.size()) + "\">\n";
+  xml += "      <PointData>\n";
+  for (const auto& field : grid.point_data) {
+    data_array("Float64",
+               "Name=\"" + xml_escape(field.name) + "\" NumberOfComponents=\"" +
+                   std::to_string(field.components) + "\"",
+               field.values.data(), field.values.size_bytes());
+  }
+  xml += "      </PointData>\n      <Points>\n";
+  data_array("Float64", "NumberOfComponents=\"3\"", grid.points.data(), grid.points.size_bytes());
+  xml += "      </Points>\n      <Cells>\n";
+  data_array("Int64", "Name=\"connectivity\"", grid.connectivity.data(),
+             grid.connectivity.size_bytes());
+  data_array("Int64", "Name=\"offsets\"", grid.offsets.data(), grid.offsets.size_bytes());
+  data_array("UInt8", "Name=\"types\"", grid.types.data(), grid.types.size_bytes());
+  xml += "      </Cells>\n    </Piece>\n  </UnstructuredGrid>\n";
+  xml += "  <AppendedData encoding=\"raw\">\n_";
+
+  std::ofstream out(path, std::ios::binary);
+  if (!out) throw std::runtime_error("Could not open file for writing: " + path.string());
+  out.write(xml.data(), static_cast<std::streamsize>(xml.size()));
+  for (const auto& block : blocks) {
+    out.write(reinterpret_cast<const char*>(&block.bytes), sizeof(block.bytes));
+    out.write(static_cast<const char*>(block.data), static_cast<std::streamsize>(block.bytes));
+  }
+  const std::string_view tail = "\n  </AppendedData>\n</VTKFile>\n";
+  out.write(tail.data(), static_cast<std::streamsize>(tail.size()));
+  out.flush();
+  if (!out) throw std::runtime_error("Failed writing VTU file");
+}
+
+}  // namespace oiseau::io::detail
@@ -0,0 +1,78 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+
+/**
+ * @file vtk.hpp
+ * @brief VTK XML unstructured grid (VTU) output of nodal DG fields.
+ *
+ * Every element is written as a VTK Lagrange cell of its own polynomial order, so high-order
+ * solutions are rendered by ParaView without sub-triangulation. Elements do not share points,
+ * which keeps the discontinuities of the DG solution visible.
+ */
+
+namespace oiseau::dg {
+class DGSpace;
+}  // namespace oiseau::dg
+
+namespace oiseau::io {
+
+/// A nodal field on a `DGSpace`, to be written as VTU point data.
+struct VTUField {
+  std::string name;
+  /// Nodal values, element by element in `DGSpace` order, `components` values per node.
+  std::span<const double> values;
+  unsigned components = 1;
+};
+
+/**
+ * @brief Writes a DG space and nodal fields on it as a VTU file with raw appended data.
+ *
+ * Element nodes and field values are interpolated to the equispaced points of the VTK Lagrange
+ * cells concurrently, and each array is then written with a single call. Pyramids are not
+ * supported.
+ */
+void vtu_write(const std::filesystem::path& path, const oiseau::dg::DGSpace& space,
+               std::span<const VTUField> fields = {});
+
+}  // namespace oiseau::io
+
+namespace oiseau::io::detail {
+
+/// VTK cell type id of the Lagrange cell of `kind`.
+std::uint8_t vtk_lagrange_cell_type(oiseau::mesh::CellKind kind);
+
+/**
+ * @brief Reference coordinates of the points of an order-`order` VTK Lagrange cell.
+ *
+ * Points are equispaced and listed in VTK order (vertices, edges, faces, interior; hexahedra
+ * follow the VTU 2.2 edge numbering), in the reference coordinates of `mesh::reference_nodes`.
+ * @return Flat array of `mesh::number_of_nodes(kind, order)` points, `dimension` values each.
+ */
+std::vector<double> vtk_lagrange_nodes(oiseau::mesh::CellKind kind, unsigned order);
+
+/// Flattened unstructured grid in the layout of a VTU piece.
+struct VTUGrid {
+  std::span<const double> points;             ///< Three coordinates per point.
+  std::span<const std::int64_t> connectivity;
+  std::span<const std::int64_t> offsets;      ///< End of each cell in `connectivity`.
+  std::span<const std::uint8_t> types;        ///< VTK cell type of each cell.
+  std::span<const VTUField> point_data;
+};
+
+/// Writes `grid` as a VTU file whose arrays are stored as raw appended data.
+void write_vtu(const std::filesystem::path& path, const VTUGrid& grid);
+
+}  // namespace oiseau::io::detail
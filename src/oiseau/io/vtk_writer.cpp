@@ -0,0 +1,127 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xadapt.hpp>
+#include <xtensor/core/xtensor_forward.hpp>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/io/vtk.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/utils/thread_pool.hpp"
+
+namespace oiseau::io {
+
+namespace {
+
+/// Interpolation from the nodes of a reference element to its VTK Lagrange points.
+struct VTKInterpolation {
+  std::size_t n_nodes;
+  std::size_t n_points;
+  std::vector<double> matrix;  ///< Row-major, n_points × n_nodes.
+};
+
+/// Computes rows of `interp.matrix` times the (row-major) `n_nodes × n_columns` matrix `in`.
+void interpolate(const VTKInterpolation& interp, const double* in, std::size_t n_columns,
+                 std::size_t out_stride, double* out) {
+  for (std::size_t p = 0; p < interp.n_points; ++p) {
+    const double* row = interp.matrix.data() + p * interp.n_nodes;
+    double* target = out + p * out_stride;
+    for (std::size_t c = 0; c < n_columns; ++c) target[c] = 0.0;
+    for (std::size_t q = 0; q < interp.n_nodes; ++q) {
+      for (std::size_t c = 0; c < n_columns; ++c) target[c] += row[q] * in[q * n_columns + c];
+    }
+  }
+}
+
+}  // namespace
+
+void vtu_write(const std::filesystem::path& path, const oiseau::dg::DGSpace& space,
+               std::span<const VTUField> fields) {
+  const auto elements = space.elements();
+  const auto cell_types = space.mesh().topology().cell_types();
+  const std::size_t n_elements = elements.size();
+
+  // Elements of one kind and order share their interpolation matrix V(r_vtk) V^-1.
+  std::map<std::pair<oiseau::mesh::CellKind, unsigned>, VTKInterpolation> cache;
+  std::vector<const VTKInterpolation*> interps(n_elements);
+  std::vector<std::size_t> node_offsets(n_elements + 1, 0);
+  std::vector<std::int64_t> offsets(n_elements);
+  std::vector<std::uint8_t> types(n_elements);
+  for (std::size_t e = 0; e < n_elements; ++e) {
+    const auto kind = cell_types[e]->kind();
+    const auto& ref = elements[e].reference();
+    auto [it, inserted] = cache.try_emplace({kind, ref.order()});
+    if (inserted) {
+      const std::size_t tdim = cell_types[e]->dimension();
+      std::vector<double> r_vtk = detail::vtk_lagrange_nodes(kind, ref.order());
+      std::array<std::size_t, 2> shape = {r_vtk.size() / tdim, tdim};
+      xt::xarray<double> r = xt::adapt(r_vtk, shape);
+      xt::xarray<double> v_vtk = ref.vandermonde(r);
+      xt::xarray<double> interp = xt::linalg::dot(v_vtk, xt::linalg::inv(ref.v()));
+      it->second = {ref.number_of_nodes(), shape[0],
+                    std::vector<double>(interp.begin(), interp.end())};
+    }
+    interps[e] = &it->second;
+    node_offsets[e + 1] = node_offsets[e] + ref.number_of_nodes();
+    offsets[e] = static_cast<std::int64_t>(node_offsets[e + 1]);
+    types[e] = detail::vtk_lagrange_cell_type(kind);
+  }
+  const std::size_t n_nodes = node_offsets.back();
+
+  for (const auto& field : fields) {
+    if (field.components == 0 || field.values.size() != n_nodes * field.components) {
+      throw std::invalid_argument("vtu_write: field '" + field.name +
+                                  "' does not match the DG space");
+    }
+  }
+
+  // Every element owns its VTK points, so the interpolation of each element is independent.
+  std::vector<double> points(3 * n_nodes, 0.0);
+  std::vector<std::vector<double>> values(fields.size());
+  for (std::size_t f = 0; f < fields.size(); ++f) {
+    values[f].resize(n_nodes * fields[f].components);
+  }
+  utils::parallel_for(
+      n_elements,
+      [&](std::size_t e) {
+        const VTKInterpolation& interp = *interps[e];
+        const std::size_t first = node_offsets[e];
+        const xt::xarray<double>& nodes = elements[e].nodes();
+        const std::size_t gdim = nodes.shape()[1];
+        interpolate(interp, nodes.data(), gdim, 3, points.data() + 3 * first);
+        for (std::size_t f = 0; f < fields.size(); ++f) {
+          const std::size_t nc = fields[f].components;
+          interpolate(interp, fields[f].values.data() + first * nc, nc, nc,
+                      values[f].data() + first * nc);
+        }
+      },
+      64);
+
+  std::vector<std::int64_t> connectivity(n_nodes);
+  std::iota(connectivity.begin(), connectivity.end(), std::int64_t{0});
+  std::vector<VTUField> point_data;
+  point_data.reserve(fields.size());
+  for (std::size_t f = 0; f < fields.size(); ++f) {
+    point_data.push_back({fields[f].name, values[f], fields[f].components});
+  }
+  detail::write_vtu(path, {points, connectivity, offsets, types, point_data});
+}
+
+}  // namespace oiseau::io
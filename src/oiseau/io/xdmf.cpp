@@ -0,0 +1,250 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/xdmf.hpp"
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "oiseau/io/xml.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/mesh.hpp"
+
+namespace oiseau::io {
+
+namespace {
+
+constexpr std::string_view index_tail = "    </Grid>\n  </Domain>\n</Xdmf>\n";
+
+/// Writes the buffers of `iov` contiguously at `offset`, resuming after partial writes.
+void pwrite_all(int fd, std::vector<iovec> iov, std::uint64_t offset) {
+  std::size_t first = 0;
+  while (first < iov.size()) {
+    if (iov[first].iov_len == 0) {
+      ++first;
+      continue;
+    }
+    const int count = static_cast<int>(std::min<std::size_t>(iov.size() - first, IOV_MAX));
+    const ssize_t n = ::pwritev(fd, iov.data() + first, count, static_cast<off_t>(offset));
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) {
+      throw std::runtime_error(std::string("Failed writing XDMF output: ") + std::strerror(errno));
+    }
+    offset += static_cast<std::uint64_t>(n);
+    for (auto left = static_cast<std::size_t>(n); left > 0;) {
+      const std::size_t step = std::min(left, iov[first].iov_len);
+      iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + step;
+      iov[first].iov_len -= step;
+      left -= step;
+      if (iov[first].iov_len == 0) ++first;
+    }
+  }
+}
+
+iovec buffer(const void* data, std::size_t bytes) { return {const_cast<void*>(data), bytes}; }
+
+iovec buffer(std::string_view s) { return buffer(s.data(), s.size()); }
+
+/// XDMF name and `Mixed` topology id of a cell kind.
+std::pair<std::string_view, std::int64_t> xdmf_cell_type(oiseau::mesh::CellKind kind) {
+  using oiseau::mesh::CellKind;
+  switch (kind) {
+  case CellKind::Point:
+    return {"Polyvertex", 1};
+  case CellKind::Interval:
+    return {"Polyline", 2};
+  case CellKind::Triangle:
+    return {"Triangle", 4};
+  case CellKind::Quadrilateral:
+    return {"Quadrilateral", 5};
+  case CellKind::Tetrahedron:
+    return {"Tetrahedron", 6};
+  case CellKind::Pyramid:
+    return {"Pyramid", 7};
+  case CellKind::Prism:
+    return {"Wedge", 8};
+  case CellKind::Hexahedron:
+    return {"Hexahedron", 9};
+  default:
+    throw std::runtime_error("Unsupported cell type for XDMF output");
+  }
+}
+
+std::string_view attribute_type(unsigned components) {
+  switch (components) {
+  case 1:
+    return "Scalar";
+  case 3:
+    return "Vector";
+  case 6:
+    return "Tensor6";
+  case 9:
+    return "Tensor";
+  default:
+    return "Matrix";
+  }
+}
+
+int open_output(const std::filesystem::path& path) {
+  const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) throw std::runtime_error("Could not open file for writing: " + path.string());
+  return fd;
+}
+
+}  // namespace
+
+XDMFWriter::XDMFWriter(const std::filesystem::path& path)
+    : m_data_name(std::filesystem::path(path).replace_extension(".bin").filename().string()) {
+  m_index_fd = open_output(path);
+  try {
+    m_data_fd = open_output(std::filesystem::path(path).replace_extension(".bin"));
+  } catch (...) {
+    ::close(m_index_fd);
+    throw;
+  }
+}
+
+XDMFWriter::XDMFWriter(const std::filesystem::path& path, const oiseau::mesh::Mesh& mesh)
+    : XDMFWriter(path) {
+  const auto& topology = mesh.topology();
+  const auto& conn = topology.conn();
+  const auto cell_types = topology.cell_types();
+  const std::size_t n_cells = topology.n_cells();
+
+  bool uniform = n_cells > 0;
+  for (std::size_t i = 1; uniform && i < n_cells; ++i) {
+    uniform = cell_types[i]->kind() == cell_types[0]->kind() && conn[i].size() == conn[0].size();
+  }
+  std::vector<std::int64_t> cells;
+  cells.reserve(conn.data().size() + (uniform ? 0 : 2 * n_cells));
+  std::string attributes;
+  std::string dimensions;
+  if (uniform) {
+    for (std::size_t i = 0; i < n_cells; ++i) {
+      cells.insert(cells.end(), conn[i].begin(), conn[i].end());
+    }
+    attributes = "TopologyType=\"" + std::string(xdmf_cell_type(cell_types[0]->kind()).first) +
+                 "\" NumberOfElements=\"" + std::to_string(n_cells) + "\" NodesPerElement=\"" +
+                 std::to_string(conn[0].size()) + "\"";
+    dimensions = std::to_string(n_cells) + " " + std::to_string(conn[0].size());
+  } else {
+    // Each cell of a mixed topology is its type id, its node count for poly-cells, its nodes.
+    for (std::size_t i = 0; i < n_cells; ++i) {
+      const std::int64_t id = xdmf_cell_type(cell_types[i]->kind()).second;
+      cells.push_back(id);
+      if (id <= 2) cells.push_back(static_cast<std::int64_t>(conn[i].size()));
+      cells.insert(cells.end(), conn[i].begin(), conn[i].end());
+    }
+    attributes = "TopologyType=\"Mixed\" NumberOfElements=\"" + std::to_string(n_cells) + "\"";
+    dimensions = std::to_string(cells.size());
+  }
+  write_mesh(mesh.geometry().x(), mesh.geometry().dim(), cells, attributes, dimensions, n_cells);
+}
+
+XDMFWriter::~XDMFWriter() {
+  if (m_index_fd >= 0) ::close(m_index_fd);
+  if (m_data_fd >= 0) ::close(m_data_fd);
+}
+
+std::string XDMFWriter::data_item(std::string_view type, std::uint64_t offset,
+                                  const std::string& dimensions) const {
+  constexpr std::string_view endian =
+      std::endian::native == std::endian::little ? "Little" : "Big";
+  return "<DataItem Format=\"Binary\" DataType=\"" + std::string(type) +
+         "\" Precision=\"8\" Endian=\"" + std::string(endian) + "\" Seek=\"" +
+         std::to_string(offset) + "\" Dimensions=\"" + dimensions + "\">" +
+         detail::xml_escape(m_data_name) + "</DataItem>";
+}
+
+void XDMFWriter::write_mesh(std::span<const double> x, std::size_t gdim,
+                            std::span<const std::int64_t> topology,
+                            const std::string& topology_attributes,
+                            const std::string& topology_dimensions, std::size_t n_cells) {
+  m_n_nodes = gdim ? x.size() / gdim : 0;
+  m_n_cells = n_cells;
+
+  // XDMF geometries are XY or XYZ; other dimensions are padded to three coordinates.
+  std::vector<double> padded;
+  if (gdim != 2 && gdim != 3) {
+    padded.assign(3 * m_n_nodes, 0.0);
+    for (std::size_t i = 0; i < m_n_nodes; ++i) {
+      std::copy_n(x.begin() + i * gdim, std::min<std::size_t>(gdim, 3), padded.begin() + 3 * i);
+    }
+    x = padded;
+    gdim = 3;
+  }
+  pwrite_all(m_data_fd,
+             {buffer(x.data(), x.size_bytes()), buffer(topology.data(), topology.size_bytes())}, 0);
+  m_data_end = x.size_bytes() + topology.size_bytes();
+
+  m_mesh_xml = "        <Topology " + topology_attributes + ">\n          " +
+               data_item("Int", x.size_bytes(), topology_dimensions) +
+               "\n        </Topology>\n        <Geometry GeometryType=\"" +
+               (gdim == 2 ? "XY" : "XYZ") + "\">\n          " +
+               data_item("Float", 0, std::to_string(m_n_nodes) + " " + std::to_string(gdim)) +
+               "\n        </Geometry>\n";
+
+  const std::string_view header =
+      "<?xml version=\"1.0\"?>\n<Xdmf Version=\"3.0\">\n  <Domain>\n"
+      "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+  pwrite_all(m_index_fd, {buffer(header), buffer(index_tail)}, 0);
+  m_index_end = header.size();
+}
+
+void XDMFWriter::write(double time, std::span<const XDMFField> fields) {
+  char time_buffer[32];
+  const auto [time_end, ec] = std::to_chars(time_buffer, time_buffer + sizeof(time_buffer), time);
+  std::string xml = "      <Grid Name=\"step_" + std::to_string(m_steps) +
+                    "\" GridType=\"Uniform\">\n        <Time Value=\"" +
+                    std::string(time_buffer, time_end) + "\"/>\n" + m_mesh_xml;
+
+  std::vector<iovec> data;
+  std::uint64_t offset = m_data_end;
+  for (const auto& field : fields) {
+    const bool node = field.center == XDMFCenter::Node;
+    const std::size_t n = node ? m_n_nodes : m_n_cells;
+    if (field.components == 0 || field.values.size() != n * field.components) {
+      throw std::invalid_argument("XDMFWriter: field '" + field.name + "' has " +
+                                  std::to_string(field.values.size()) + " values, expected " +
+                                  std::to_string(n * field.components));
+    }
+    xml += "        <Attribute Name=\"" + detail::xml_escape(field.name) + "\" AttributeType=\"" +
+           std::string(attribute_type(field.components)) + "\" Center=\"" +
+           (node ? "Node" : "Cell") + "\">\n          " +
+           data_item("Float", offset,
+                     std::to_string(n) + " " + std::to_string(field.components)) +
+           "\n        </Attribute>\n";
+    data.push_back(buffer(field.values.data(), field.values.size_bytes()));
+    offset += field.values.size_bytes();
+  }
+  xml += "      </Grid>\n";
+
+  // Data first, then the index entry that refers to it.
+  pwrite_all(m_data_fd, std::move(data), m_data_end);
+  m_data_end = offset;
+  pwrite_all(m_index_fd, {buffer(xml), buffer(index_tail)}, m_index_end);
+  m_index_end += xml.size();
+  ++m_steps;
+}
+
+}  // namespace oiseau::io
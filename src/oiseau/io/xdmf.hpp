@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "oiseau/mesh/mesh.hpp"
+
+/**
+ * @file xdmf.hpp
+ * @brief XDMF time series backed by a single raw binary file.
+ */
+
+namespace oiseau::dg {
+class DGSpace;
+}  // namespace oiseau::dg
+
+namespace oiseau::io {
+
+/// Whether a field holds one value per mesh node or per cell.
+enum class XDMFCenter { Node, Cell };
+
+/// A field of one snapshot; `values` holds `components` consecutive values per node or cell.
+struct XDMFField {
+  std::string name;
+  std::span<const double> values;
+  unsigned components = 1;
+  XDMFCenter center = XDMFCenter::Node;
+};
+
+/**
+ * @class XDMFWriter
+ * @brief Writes a temporal collection of snapshots that all share one mesh.
+ *
+ * `path` names the XDMF index; the heavy data goes to `path` with the extension `.bin`. The mesh
+ * is stored once at the start of the binary file and every grid of the index refers to it by
+ * offset. Each snapshot is then appended with a single `pwritev` of all its fields, after which
+ * the new grid is written over the closing tags of the index, so the index on disk is valid
+ * after every step and never refers to data that has not been written yet.
+ */
+class XDMFWriter {
+ public:
+  /// Writes the vertices and cells of `mesh`; high-order geometry nodes are not used.
+  XDMFWriter(const std::filesystem::path& path, const oiseau::mesh::Mesh& mesh);
+  /// Writes the nodes of every element of `space` as a point cloud, one point per DG node.
+  XDMFWriter(const std::filesystem::path& path, const oiseau::dg::DGSpace& space);
+  XDMFWriter(const XDMFWriter&) = delete;
+  XDMFWriter& operator=(const XDMFWriter&) = delete;
+  ~XDMFWriter();
+
+  /// Appends a snapshot at `time`; throws `std::invalid_argument` if a field has a wrong size.
+  void write(double time, std::span<const XDMFField> fields);
+
+  inline std::size_t num_steps() const { return m_steps; }
+  inline std::size_t num_nodes() const { return m_n_nodes; }
+  inline std::size_t num_cells() const { return m_n_cells; }
+
+ private:
+  explicit XDMFWriter(const std::filesystem::path& path);
+
+  /// Stores the mesh at the start of the binary file and prepares its XML description.
+  void write_mesh(std::span<const double> x, std::size_t gdim,
+                  std::span<const std::int64_t> topology, const std::string& topology_attributes,
+                  const std::string& topology_dimensions, std::size_t n_cells);
+  /// A DataItem reading 8-byte values of `type` at `offset` of the binary file.
+  std::string data_item(std::string_view type, std::uint64_t offset,
+                        const std::string& dimensions) const;
+
+  std::string m_data_name;  ///< Binary file name, relative to the index.
+  int m_index_fd = -1;
+  int m_data_fd = -1;
+  std::uint64_t m_index_end = 0;  ///< Start of the closing tags in the index.
+  std::uint64_t m_data_end = 0;
+  std::string m_mesh_xml;
+  std::size_t m_n_nodes = 0;
+  std::size_t m_n_cells = 0;
+  std::size_t m_steps = 0;
+};
+
+}  // namespace oiseau::io
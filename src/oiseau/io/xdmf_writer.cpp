@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <xtensor/core/xtensor_forward.hpp>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/io/xdmf.hpp"
+
+namespace oiseau::io {
+
+XDMFWriter::XDMFWriter(const std::filesystem::path& path, const oiseau::dg::DGSpace& space)
+    : XDMFWriter(path) {
+  // DG nodes are written as a point cloud, so cell-centred fields are per node as well.
+  const auto elements = space.elements();
+  const std::size_t gdim =
+      elements.empty() ? space.mesh().geometry().dim() : elements.front().nodes().shape()[1];
+  std::vector<double> x;
+  for (const auto& element : elements) {
+    x.insert(x.end(), element.nodes().begin(), element.nodes().end());
+  }
+  const std::size_t n_nodes = gdim ? x.size() / gdim : 0;
+  std::vector<std::int64_t> cells(n_nodes);
+  std::iota(cells.begin(), cells.end(), std::int64_t{0});
+  write_mesh(x, gdim, cells,
+             "TopologyType=\"Polyvertex\" NumberOfElements=\"" + std::to_string(n_nodes) +
+                 "\" NodesPerElement=\"1\"",
+             std::to_string(n_nodes), n_nodes);
+}
+
+}  // namespace oiseau::io
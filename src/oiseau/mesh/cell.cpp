@@ -47,6 +47,12 @@ CellType get_cell_type(const CellKind cell_kind) {
   case CellKind::Hexahedron:
     cell = std::make_unique<HexahedronCell>();
     break;
+  case CellKind::Prism:
+    cell = std::make_unique<PrismCell>();
+    break;
+  case CellKind::Pyramid:
+    cell = std::make_unique<PyramidCell>();
+    break;
   default:
     throw std::runtime_error("Unknown cell type");
   }
@@ -247,4 +253,86 @@ HexahedronCell::HexahedronCell() {
   m_edge = get_cell_type(CellKind::Interval);
 }
 
+PrismCell::PrismCell() {
+  m_name = "prism";
+  m_kind = CellKind::Prism;
+  m_dim = 3;
+  m_geometry = {
+      {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0},
+      {6, 3},
+  };
+  m_topology = {
+      {
+          {{0}, {0, 1, 2}, {0, 2, 4}, {0}},
+          {{1}, {0, 3, 4}, {0, 2, 3}, {0}},
+          {{2}, {1, 3, 5}, {0, 3, 4}, {0}},
+          {{3}, {2, 6, 7}, {1, 2, 4}, {0}},
+          {{4}, {4, 6, 8}, {1, 2, 3}, {0}},
+          {{5}, {5, 7, 8}, {1, 3, 4}, {0}},
+      },
+      {
+          {{0, 1}, {0}, {0, 2}, {0}},
+          {{0, 2}, {1}, {0, 4}, {0}},
+          {{0, 3}, {2}, {2, 4}, {0}},
+          {{1, 2}, {3}, {0, 3}, {0}},
+          {{1, 4}, {4}, {2, 3}, {0}},
+          {{2, 5}, {5}, {3, 4}, {0}},
+          {{3, 4}, {6}, {1, 2}, {0}},
+          {{3, 5}, {7}, {1, 4}, {0}},
+          {{4, 5}, {8}, {1, 3}, {0}},
+      },
+      {
+          {{0, 1, 2}, {0, 1, 3}, {0}, {0}},
+          {{3, 4, 5}, {6, 7, 8}, {1}, {0}},
+          {{0, 1, 4, 3}, {0, 2, 4, 6}, {2}, {0}},
+          {{1, 2, 5, 4}, {3, 4, 5, 8}, {3}, {0}},
+          {{0, 2, 5, 3}, {1, 2, 5, 7}, {4}, {0}},
+      },
+      {
+          {{0, 1, 2, 3, 4, 5}, {0, 1, 2, 3, 4, 5, 6, 7, 8}, {0, 1, 2, 3, 4}, {0}},
+      },
+  };
+  m_edge = get_cell_type(CellKind::Interval);
+}
+
+PyramidCell::PyramidCell() {
+  m_name = "pyramid";
+  m_kind = CellKind::Pyramid;
+  m_dim = 3;
+  m_geometry = {
+      {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.5, 0.5, 1.0},
+      {5, 3},
+  };
+  m_topology = {
+      {
+          {{0}, {0, 1, 2}, {0, 1, 4}, {0}},
+          {{1}, {0, 3, 4}, {0, 1, 2}, {0}},
+          {{2}, {3, 5, 6}, {0, 2, 3}, {0}},
+          {{3}, {1, 5, 7}, {0, 3, 4}, {0}},
+          {{4}, {2, 4, 6, 7}, {1, 2, 3, 4}, {0}},
+      },
+      {
+          {{0, 1}, {0}, {0, 1}, {0}},
+          {{0, 3}, {1}, {0, 4}, {0}},
+          {{0, 4}, {2}, {1, 4}, {0}},
+          {{1, 2}, {3}, {0, 2}, {0}},
+          {{1, 4}, {4}, {1, 2}, {0}},
+          {{2, 3}, {5}, {0, 3}, {0}},
+          {{2, 4}, {6}, {2, 3}, {0}},
+          {{3, 4}, {7}, {3, 4}, {0}},
+      },
+      {
+          {{0, 1, 2, 3}, {0, 1, 3, 5}, {0}, {0}},
+          {{0, 1, 4}, {0, 2, 4}, {1}, {0}},
+          {{1, 2, 4}, {3, 4, 6}, {2}, {0}},
+          {{2, 3, 4}, {5, 6, 7}, {3}, {0}},
+          {{3, 0, 4}, {1, 2, 7}, {4}, {0}},
+      },
+      {
+          {{0, 1, 2, 3, 4}, {0, 1, 2, 3, 4, 5, 6, 7}, {0, 1, 2, 3, 4}, {0}},
+      },
+  };
+  m_edge = get_cell_type(CellKind::Interval);
+}
+
 }  // namespace oiseau::mesh
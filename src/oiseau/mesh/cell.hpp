@@ -25,7 +25,9 @@ enum class CellKind {
   Triangle,
   Quadrilateral,
   Tetrahedron,
-  Hexahedron
+  Hexahedron,
+  Prism,
+  Pyramid
 };
 
 CellType get_cell_type(const CellKind cell);
@@ -87,4 +89,16 @@ class HexahedronCell : public Cell {
   HexahedronCell();
 };
 
+/// Triangular prism; its facets mix triangles and quadrilaterals, so `facet()` is null.
+class PrismCell : public Cell {
+ public:
+  PrismCell();
+};
+
+/// Square-based pyramid; its facets mix triangles and quadrilaterals, so `facet()` is null.
+class PyramidCell : public Cell {
+ public:
+  PyramidCell();
+};
+
 }  // namespace oiseau::mesh
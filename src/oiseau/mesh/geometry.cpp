@@ -6,16 +6,177 @@
 
 #include "oiseau/mesh/geometry.hpp"
 
+#include <array>
 #include <cstddef>
 #include <span>
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
 using namespace oiseau::mesh;
 
 Geometry::Geometry() = default;
 Geometry::~Geometry() = default;
 std::span<double> Geometry::x() { return m_x; };
+std::span<const double> Geometry::x() const { return m_x; };
 std::span<double> Geometry::x_at(std::size_t pos) { return {&m_x[pos * m_dim], 3}; };
 Geometry::Geometry(std::vector<double> &&x, unsigned dim) : m_x(std::move(x)), m_dim(dim) {};
 unsigned Geometry::dim() const { return m_dim; };
+
+Geometry::Geometry(std::vector<double> &&x, unsigned dim,
+                   oiseau::utils::JaggedArray<std::size_t> &&high_order_nodes)
+    : m_x(std::move(x)), m_dim(dim), m_high_order_nodes(std::move(high_order_nodes)) {};
+
+oiseau::utils::JaggedArray<std::size_t> &Geometry::high_order_nodes() {
+  return m_high_order_nodes;
+};
+const oiseau::utils::JaggedArray<std::size_t> &Geometry::high_order_nodes() const {
+  return m_high_order_nodes;
+};
+
+namespace {
+
+using Lattice = std::vector<std::array<unsigned, 3>>;
+
+/// Appends the gmsh-ordered lattice points of an order-`p` line starting at `i0`.
+void line_lattice(unsigned p, unsigned i0, Lattice &out) {
+  out.push_back({i0, 0, 0});
+  if (p == 0) return;
+  out.push_back({i0 + p, 0, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0 + k, 0, 0});
+}
+
+/// Appends the gmsh-ordered lattice points of an order-`p` triangle with corner `(i0, j0)`.
+void triangle_lattice(unsigned p, unsigned i0, unsigned j0, Lattice &out) {
+  out.push_back({i0, j0, 0});
+  if (p == 0) return;
+  out.push_back({i0 + p, j0, 0});
+  out.push_back({i0, j0 + p, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0 + k, j0, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0 + p - k, j0 + k, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0, j0 + p - k, 0});
+  if (p >= 3) triangle_lattice(p - 3, i0 + 1, j0 + 1, out);
+}
+
+/// Appends the gmsh-ordered lattice points of an order-`p` quadrilateral with corner `(i0, j0)`.
+void quadrilateral_lattice(unsigned p, unsigned i0, unsigned j0, Lattice &out) {
+  out.push_back({i0, j0, 0});
+  if (p == 0) return;
+  out.push_back({i0 + p, j0, 0});
+  out.push_back({i0 + p, j0 + p, 0});
+  out.push_back({i0, j0 + p, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0 + k, j0, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0 + p, j0 + k, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0 + p - k, j0 + p, 0});
+  for (unsigned k = 1; k < p; ++k) out.push_back({i0, j0 + p - k, 0});
+  if (p >= 2) quadrilateral_lattice(p - 2, i0 + 1, j0 + 1, out);
+}
+
+/// Second-order lattices (on [0, 2]^3) of gmsh's tet10 and hex27.
+const Lattice tetrahedron10 = {
+    {0, 0, 0}, {2, 0, 0}, {0, 2, 0}, {0, 0, 2}, {1, 0, 0},
+    {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {0, 1, 1}, {1, 0, 1},
+};
+const Lattice hexahedron27 = {
+    {0, 0, 0}, {2, 0, 0}, {2, 2, 0}, {0, 2, 0}, {0, 0, 2}, {2, 0, 2}, {2, 2, 2},
+    {0, 2, 2}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {2, 1, 0}, {2, 0, 1}, {1, 2, 0},
+    {2, 2, 1}, {0, 2, 1}, {1, 0, 2}, {0, 1, 2}, {2, 1, 2}, {1, 2, 2}, {1, 1, 0},
+    {1, 0, 1}, {0, 1, 1}, {2, 1, 1}, {1, 2, 1}, {1, 1, 2}, {1, 1, 1},
+};
+
+}  // namespace
+
+std::size_t oiseau::mesh::number_of_nodes(CellKind kind, unsigned order) {
+  const std::size_t p = order;
+  switch (kind) {
+  case CellKind::Point:
+    return 1;
+  case CellKind::Interval:
+    return p + 1;
+  case CellKind::Triangle:
+    return (p + 1) * (p + 2) / 2;
+  case CellKind::Quadrilateral:
+    return (p + 1) * (p + 1);
+  case CellKind::Tetrahedron:
+    return (p + 1) * (p + 2) * (p + 3) / 6;
+  case CellKind::Hexahedron:
+    return (p + 1) * (p + 1) * (p + 1);
+  case CellKind::Prism:
+    return (p + 1) * (p + 1) * (p + 2) / 2;
+  case CellKind::Pyramid:
+    return (p + 1) * (p + 2) * (2 * p + 3) / 6;
+  default:
+    throw std::runtime_error("Unknown cell type");
+  }
+}
+
+unsigned oiseau::mesh::geometry_order(CellKind kind, std::size_t n_nodes) {
+  if (kind == CellKind::Point) return 1;
+  for (unsigned order = 1; number_of_nodes(kind, order) <= n_nodes; ++order) {
+    if (number_of_nodes(kind, order) == n_nodes) return order;
+  }
+  throw std::runtime_error("No Lagrange geometry with " + std::to_string(n_nodes) + " nodes");
+}
+
+std::vector<double> oiseau::mesh::reference_nodes(CellKind kind, unsigned order) {
+  if (order == 0) throw std::invalid_argument("Order must be greater than 0");
+  Lattice lattice;
+  unsigned dim = 0;
+  switch (kind) {
+  case CellKind::Point:
+    return {};
+  case CellKind::Interval:
+    dim = 1;
+    line_lattice(order, 0, lattice);
+    break;
+  case CellKind::Triangle:
+    dim = 2;
+    triangle_lattice(order, 0, 0, lattice);
+    break;
+  case CellKind::Quadrilateral:
+    dim = 2;
+    quadrilateral_lattice(order, 0, 0, lattice);
+    break;
+  case CellKind::Tetrahedron:
+  case CellKind::Hexahedron: {
+    dim = 3;
+    const bool simplex = kind == CellKind::Tetrahedron;
+    const Lattice &second = simplex ? tetrahedron10 : hexahedron27;
+    if (order == 1) {
+      lattice.assign(second.begin(), second.begin() + (simplex ? 4 : 8));
+      for (auto &point : lattice) {
+        for (auto &c : point) c /= 2;
+      }
+    } else if (order == 2) {
+      lattice = second;
+    } else {
+      throw std::runtime_error("Unsupported geometry order for 3D cells: " +
+                               std::to_string(order));
+    }
+    break;
+  }
+  case CellKind::Prism:
+  case CellKind::Pyramid:
+    if (order != 1) {
+      throw std::runtime_error("Unsupported geometry order for prisms and pyramids: " +
+                               std::to_string(order));
+    }
+    if (kind == CellKind::Prism) {
+      return {-1, -1, -1, 1, -1, -1, -1, 1, -1, -1, -1, 1, 1, -1, 1, -1, 1, 1};
+    }
+    return {-1, -1, -1, 1, -1, -1, 1, 1, -1, -1, 1, -1, 0, 0, 1};
+  default:
+    throw std::runtime_error("Unknown cell type");
+  }
+
+  std::vector<double> nodes;
+  nodes.reserve(lattice.size() * dim);
+  for (const auto &point : lattice) {
+    for (unsigned d = 0; d < dim; ++d) nodes.push_back(2.0 * point[d] / order - 1.0);
+  }
+  return nodes;
+}
@@ -9,11 +9,16 @@
 #include <span>
 #include <vector>
 
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
 namespace oiseau::mesh {
 class Geometry {
  public:
   Geometry();
   Geometry(std::vector<double> &&x, unsigned dim);
+  Geometry(std::vector<double> &&x, unsigned dim,
+           utils::JaggedArray<std::size_t> &&high_order_nodes);
   Geometry(Geometry &&) = default;
   Geometry(const Geometry &) = default;
   Geometry &operator=(Geometry &&) = default;
@@ -21,11 +26,40 @@ class Geometry {
   ~Geometry();
 
   std::span<double> x();
+  std::span<const double> x() const;
   std::span<double> x_at(std::size_t pos);
   unsigned dim() const;
 
+  /**
+   * @brief Geometry nodes of every cell beyond its vertices, for curved (high-order) cells.
+   *
+   * Row `i` continues the vertex list `topology.conn()[i]`; together they list the nodes of the
+   * cell's geometric map in the order of `reference_nodes`. Empty (no rows) for affine meshes.
+   */
+  utils::JaggedArray<std::size_t> &high_order_nodes();
+  const utils::JaggedArray<std::size_t> &high_order_nodes() const;
+
  private:
   std::vector<double> m_x;
   unsigned m_dim = 3;
+  utils::JaggedArray<std::size_t> m_high_order_nodes;
 };
+
+/// Number of nodes of an order-`order` Lagrange geometry of a `kind` cell.
+std::size_t number_of_nodes(CellKind kind, unsigned order);
+
+/// Order of the Lagrange geometry of a `kind` cell defined by `n_nodes` nodes.
+unsigned geometry_order(CellKind kind, std::size_t n_nodes);
+
+/**
+ * @brief Reference coordinates of the nodes of an order-`order` Lagrange geometry.
+ *
+ * Nodes follow the gmsh convention: vertices, then the nodes on every edge, face and the
+ * interior. Coordinates are given in the reference cells used by `dg::nodal` (simplices with
+ * vertices at -1 and 1, tensor cells on [-1, 1]^d) and returned row-major, `dimension` values
+ * per node. Tetrahedra and hexahedra are supported up to second order, prisms and pyramids
+ * (whose apex sits at (0, 0, 1)) only at first order.
+ */
+std::vector<double> reference_nodes(CellKind kind, unsigned order);
+
 }  // namespace oiseau::mesh
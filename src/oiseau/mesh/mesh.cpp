@@ -6,8 +6,18 @@
 
 #include "oiseau/mesh/mesh.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include "oiseau/mesh/geometry.hpp"
 #include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
 
 using namespace oiseau::mesh;
 
@@ -15,3 +25,46 @@ Topology& Mesh::topology() { return _topology; }
 const Topology& Mesh::topology() const { return _topology; }
 Geometry& Mesh::geometry() { return _geometry; }
 const Geometry& Mesh::geometry() const { return _geometry; }
+
+std::vector<AttributeRange> oiseau::mesh::attribute_ranges(std::span<const std::int32_t> values) {
+  std::vector<AttributeRange> ranges;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (ranges.empty() || ranges.back().value != values[i]) {
+      ranges.push_back({values[i], i, i + 1});
+    } else {
+      ranges.back().end = i + 1;
+    }
+  }
+  return ranges;
+}
+
+CellSort oiseau::mesh::sort_cells_by(Mesh& mesh, CellAttribute attribute) {
+  Topology& topology = mesh.topology();
+  const auto values = attribute == CellAttribute::EntityTag ? topology.entity_tags()
+                                                            : topology.physical_tags();
+  if (values.size() != topology.n_cells()) {
+    throw std::invalid_argument("sort_cells_by: the mesh has no such cell attribute");
+  }
+  std::vector<std::size_t> order(values.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::stable_sort(order, {}, [&](std::size_t i) { return values[i]; });
+
+  auto& high_order_nodes = mesh.geometry().high_order_nodes();
+  if (high_order_nodes.num_rows() > 0) {
+    std::vector<std::size_t> offsets(order.size() + 1, 0);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      offsets[i + 1] = offsets[i] + high_order_nodes[order[i]].size();
+    }
+    std::vector<std::size_t> data(offsets.back());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      const auto row = high_order_nodes[order[i]];
+      std::copy(row.begin(), row.end(), data.begin() + offsets[i]);
+    }
+    high_order_nodes =
+        oiseau::utils::JaggedArray<std::size_t>(std::move(data), std::move(offsets));
+  }
+  topology.permute_cells(order);
+  const auto sorted = attribute == CellAttribute::EntityTag ? topology.entity_tags()
+                                                            : topology.physical_tags();
+  return {std::move(order), attribute_ranges(sorted)};
+}
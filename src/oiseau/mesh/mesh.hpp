@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <utility>
+#include <vector>
 
 #include "oiseau/mesh/geometry.hpp"
 #include "oiseau/mesh/topology.hpp"
@@ -35,4 +39,32 @@ class Mesh {
   Geometry _geometry;
 };
 
+/// A per-cell attribute held by `Topology`.
+enum class CellAttribute { EntityTag, PhysicalTag };
+
+/// Cells `[begin, end)` share the attribute `value`.
+struct AttributeRange {
+  std::int32_t value;
+  std::size_t begin;
+  std::size_t end;
+};
+
+/// The runs of equal consecutive `values`, in order.
+std::vector<AttributeRange> attribute_ranges(std::span<const std::int32_t> values);
+
+/// Result of `sort_cells_by`.
+struct CellSort {
+  std::vector<std::size_t> order;      ///< New cell `i` is the old cell `order[i]`.
+  std::vector<AttributeRange> ranges;  ///< One range per attribute value, by increasing value.
+};
+
+/**
+ * @brief Sorts the cells of `mesh` by `attribute`, keeping the order of cells with equal values.
+ *
+ * High-order geometry nodes follow their cells. Afterwards every attribute value covers a single
+ * contiguous range of cells, so attribute-dependent kernels can loop over homogeneous ranges
+ * with constant coefficients. Throws `std::invalid_argument` if the attribute is not set.
+ */
+CellSort sort_cells_by(Mesh &mesh, CellAttribute attribute);
+
 }  // namespace oiseau::mesh
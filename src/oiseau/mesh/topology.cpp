@@ -8,13 +8,16 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <numeric>
 #include <span>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 #include <xtensor/containers/xadapt.hpp>
 
 #include "oiseau/mesh/cell.hpp"
+#include "oiseau/utils/jagged_array.hpp"
 
 using namespace oiseau::mesh;
 
@@ -22,20 +25,76 @@ Topology::Topology() = default;
 Topology::~Topology() = default;
 
 Topology::Topology(std::vector<std::vector<std::size_t>>&& conn, std::vector<CellType>&& cell_types)
+    : m_cell_types(std::move(cell_types)) {
+  for (auto& row : conn) m_conn.add_row(std::move(row));
+};
+
+Topology::Topology(oiseau::utils::JaggedArray<std::size_t>&& conn,
+                   std::vector<CellType>&& cell_types)
     : m_conn(std::move(conn)), m_cell_types(std::move(cell_types)) {};
 
+Topology::Topology(oiseau::utils::JaggedArray<std::size_t>&& conn,
+                   std::vector<CellType>&& cell_types, FacetTable&& facets)
+    : m_conn(std::move(conn)), m_cell_types(std::move(cell_types)), m_facets(std::move(facets)) {};
+
 std::span<CellType> Topology::cell_types() { return m_cell_types; };
+std::span<const CellType> Topology::cell_types() const { return m_cell_types; };
 
-std::span<std::vector<std::size_t>> Topology::conn() { return m_conn; };
+oiseau::utils::JaggedArray<std::size_t>& Topology::conn() { return m_conn; };
+const oiseau::utils::JaggedArray<std::size_t>& Topology::conn() const { return m_conn; };
 std::span<std::vector<std::size_t>> Topology::e_to_e() { return m_e_to_e; };
 std::span<std::vector<std::size_t>> Topology::e_to_f() { return m_e_to_f; };
 
-std::size_t Topology::n_cells() const { return m_conn.size(); }
+std::size_t Topology::n_cells() const { return m_conn.num_rows(); }
+
+FacetTable& Topology::facets() { return m_facets; };
+const FacetTable& Topology::facets() const { return m_facets; };
+
+std::span<const std::int32_t> Topology::entity_tags() const { return m_entity_tags; }
+std::span<const std::int32_t> Topology::physical_tags() const { return m_physical_tags; }
+
+void Topology::set_cell_attributes(std::vector<std::int32_t>&& entity_tags,
+                                   std::vector<std::int32_t>&& physical_tags) {
+  for (const auto* tags : {&entity_tags, &physical_tags}) {
+    if (!tags->empty() && tags->size() != n_cells()) {
+      throw std::invalid_argument("Cell attributes must hold one value per cell");
+    }
+  }
+  m_entity_tags = std::move(entity_tags);
+  m_physical_tags = std::move(physical_tags);
+}
+
+void Topology::permute_cells(std::span<const std::size_t> order) {
+  if (order.size() != n_cells()) {
+    throw std::invalid_argument("A cell permutation must hold one index per cell");
+  }
+  std::vector<std::size_t> offsets(order.size() + 1, 0);
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    offsets[i + 1] = offsets[i] + m_conn[order[i]].size();
+  }
+  std::vector<std::size_t> data(offsets.back());
+  std::vector<CellType> cell_types(order.size());
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    const auto row = m_conn[order[i]];
+    std::copy(row.begin(), row.end(), data.begin() + offsets[i]);
+    cell_types[i] = m_cell_types[order[i]];
+  }
+  for (auto* tags : {&m_entity_tags, &m_physical_tags}) {
+    if (tags->empty()) continue;
+    std::vector<std::int32_t> permuted(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i) permuted[i] = (*tags)[order[i]];
+    *tags = std::move(permuted);
+  }
+  m_conn = oiseau::utils::JaggedArray<std::size_t>(std::move(data), std::move(offsets));
+  m_cell_types = std::move(cell_types);
+  m_e_to_e.clear();
+  m_e_to_f.clear();
+}
 
 void Topology::calculate_connectivity() {
   // this should be extended to 3d and for mixed cells squares/triangles
   std::vector<std::vector<std::vector<std::size_t>>> faces;
-  for (std::size_t i = 0; i < m_conn.size(); i++) {
+  for (std::size_t i = 0; i < m_conn.num_rows(); i++) {
     auto cell = m_cell_types[i];
     if (cell->kind() != CellKind::Triangle) continue;
     auto _conn = m_conn[i];
@@ -6,35 +6,85 @@
 
 #pragma once
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <vector>
 
 #include "oiseau/mesh/cell.hpp"
+#include "oiseau/utils/jagged_array.hpp"
 
 namespace oiseau::mesh {
 
+/**
+ * @brief Elements of lower dimension than the cells, such as the tagged boundary faces of an
+ * imported mesh.
+ *
+ * Row `i` of `conn` lists the vertices of facet `i`, whose type is `cell_types[i]` and whose
+ * physical group is `physical_tags[i]` (0 when it has none).
+ */
+struct FacetTable {
+  utils::JaggedArray<std::size_t> conn{};
+  std::vector<CellType> cell_types{};
+  std::vector<std::int32_t> physical_tags{};
+
+  inline std::size_t size() const { return cell_types.size(); }
+};
+
 class Topology {
  public:
   Topology();
   Topology(std::vector<std::vector<std::size_t>> &&conn, std::vector<CellType> &&cell_types);
+  Topology(utils::JaggedArray<std::size_t> &&conn, std::vector<CellType> &&cell_types);
+  Topology(utils::JaggedArray<std::size_t> &&conn, std::vector<CellType> &&cell_types,
+           FacetTable &&facets);
   Topology(Topology &&) = default;
   Topology(const Topology &) = default;
   Topology &operator=(Topology &&) = default;
   Topology &operator=(const Topology &) = default;
   ~Topology();
   std::span<CellType> cell_types();
-  std::span<std::vector<std::size_t>> conn();
+  std::span<const CellType> cell_types() const;
+  utils::JaggedArray<std::size_t> &conn();
+  const utils::JaggedArray<std::size_t> &conn() const;
   std::span<std::vector<std::size_t>> e_to_e();
   std::span<std::vector<std::size_t>> e_to_f();
   std::size_t n_cells() const;
+  /// Lower-dimensional elements kept apart from the cells; empty unless given on construction.
+  FacetTable &facets();
+  const FacetTable &facets() const;
+
+  /// Entity (region) tag of every cell, as in the imported file; empty when not set.
+  std::span<const std::int32_t> entity_tags() const;
+  /// Physical group (material) of every cell, 0 when it has none; empty when not set.
+  std::span<const std::int32_t> physical_tags() const;
+  /**
+   * @brief Sets the per-cell attribute arrays.
+   *
+   * Each array is either empty or holds one value per cell; throws `std::invalid_argument`
+   * otherwise.
+   */
+  void set_cell_attributes(std::vector<std::int32_t> &&entity_tags,
+                           std::vector<std::int32_t> &&physical_tags);
+
+  /**
+   * @brief Reorders the cells so that new cell `i` is old cell `order[i]`.
+   *
+   * Connectivity, cell types and attributes follow the cells; the cell neighbours are cleared
+   * and must be recalculated.
+   */
+  void permute_cells(std::span<const std::size_t> order);
+
   void calculate_connectivity();
 
  private:
-  std::vector<std::vector<std::size_t>> m_conn;
+  utils::JaggedArray<std::size_t> m_conn;
   std::vector<std::vector<std::size_t>> m_e_to_v;
   std::vector<std::vector<std::size_t>> m_e_to_e;
   std::vector<std::vector<std::size_t>> m_e_to_f;
   std::vector<CellType> m_cell_types;
+  FacetTable m_facets;
+  std::vector<std::int32_t> m_entity_tags;
+  std::vector<std::int32_t> m_physical_tags;
 };
 
 }  // namespace oiseau::mesh
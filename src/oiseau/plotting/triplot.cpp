@@ -21,15 +21,15 @@
 namespace oiseau::plotting {
 
 void triplot(plt::AxesSubPlot &ax, oiseau::mesh::Mesh &mesh) {
-  auto topology = mesh.topology();
-  auto geometry = mesh.geometry();
-  auto connectivity = topology.conn();
+  auto &topology = mesh.topology();
+  auto &geometry = mesh.geometry();
+  const auto &connectivity = topology.conn();
   auto x = geometry.x();
 
   std::vector<std::size_t> shape = {x.size() / geometry.dim(), geometry.dim()};
   auto coords = xt::adapt(x.data(), x.size(), xt::no_ownership(), shape);
 
-  for (std::size_t i = 0; i < connectivity.size(); ++i) {
+  for (std::size_t i = 0; i < connectivity.num_rows(); ++i) {
     auto cell = topology.cell_types()[i];
     auto conn = connectivity[i];
 
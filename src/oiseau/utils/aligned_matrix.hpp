@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "oiseau/utils/mdarray.hpp"
+
+namespace oiseau::utils {
+
+/// Alignment in bytes of `AlignedMatrix` rows: a cache line, or one AVX-512 register.
+inline constexpr std::size_t matrix_alignment = 64;
+
+/// Allocator of storage aligned to `Alignment` bytes.
+template <class T, std::size_t Alignment = matrix_alignment>
+struct AlignedAllocator {
+  using value_type = T;
+
+  template <class U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() noexcept = default;
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+  }
+  void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t{Alignment}); }
+
+  template <class U>
+  bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+    return true;
+  }
+};
+
+template <class T>
+using aligned_vector = std::vector<T, AlignedAllocator<T>>;
+
+/// Row-major rank-2 view whose row stride may exceed the number of columns.
+template <class T>
+using matrix_view = std::mdspan<T, std::dextents<std::size_t, 2>, std::layout_stride>;
+
+/**
+ * @class AlignedMatrix
+ * @brief Row-major matrix of doubles whose rows start on 64-byte boundaries.
+ *
+ * The leading dimension is the number of columns rounded up to whole 64-byte lines and the
+ * padding is zero, so kernels can use fixed strides and full-width vector loops on every row.
+ */
+class AlignedMatrix {
+ public:
+  using extents_type = std::dextents<std::size_t, 2>;
+  using storage_type =
+      stdex::mdarray<double, extents_type, std::layout_right, aligned_vector<double>>;
+
+  /// Doubles per 64-byte line.
+  static constexpr std::size_t lane = matrix_alignment / sizeof(double);
+
+  AlignedMatrix() = default;
+
+  /// A zero `rows × cols` matrix.
+  AlignedMatrix(std::size_t rows, std::size_t cols)
+      : m_cols(cols),
+        m_storage(extents_type(rows, padded(cols)), aligned_vector<double>(rows * padded(cols))) {}
+
+  /// Copies the rank-2 expression `e`, e.g. an `xt::xarray<double>` or an `xt::view` of one.
+  template <class E>
+  static AlignedMatrix from(const E& e) {
+    AlignedMatrix out(e.shape()[0], e.shape()[1]);
+    for (std::size_t i = 0; i < out.rows(); ++i) {
+      for (std::size_t j = 0; j < out.cols(); ++j) out(i, j) = e(i, j);
+    }
+    return out;
+  }
+
+  inline std::size_t rows() const { return m_storage.extent(0); }
+  inline std::size_t cols() const { return m_cols; }
+  /// Leading dimension: the distance in doubles between consecutive rows.
+  inline std::size_t stride() const { return m_storage.extent(1); }
+  inline bool empty() const { return rows() == 0 || m_cols == 0; }
+
+  inline double* data() { return m_storage.data(); }
+  inline const double* data() const { return m_storage.data(); }
+
+  inline double& operator()(std::size_t i, std::size_t j) { return data()[i * stride() + j]; }
+  inline double operator()(std::size_t i, std::size_t j) const { return data()[i * stride() + j]; }
+
+  inline matrix_view<double> view() { return {data(), mapping()}; }
+  inline matrix_view<const double> view() const { return {data(), mapping()}; }
+
+  /// Number of columns rounded up to whole 64-byte lines.
+  static constexpr std::size_t padded(std::size_t cols) { return (cols + lane - 1) / lane * lane; }
+
+ private:
+  std::layout_stride::mapping<extents_type> mapping() const {
+    return {extents_type(rows(), m_cols), std::array<std::size_t, 2>{stride(), 1}};
+  }
+
+  std::size_t m_cols = 0;
+  storage_type m_storage;
+};
+
+}  // namespace oiseau::utils
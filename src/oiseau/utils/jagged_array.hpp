@@ -11,8 +11,9 @@
 #include <iostream>          // For std::ostream and operator<<
 #include <iterator>          // For std::iterator related tags
 #include <span>              // For std::span
-#include <stdexcept>         // For std::out_of_range
+#include <stdexcept>         // For std::out_of_range, std::invalid_argument
 #include <string>            // For std::to_string in error messages
+#include <utility>           // For std::move
 #include <vector>
 
 namespace oiseau::utils {
@@ -83,6 +84,19 @@ class JaggedArray {
     }
   }
 
+  /**
+   * @brief Adopts already flattened storage.
+   * @param data Row elements stored contiguously.
+   * @param row_offsets Start offset of every row followed by `data.size()`.
+   */
+  JaggedArray(std::vector<T>&& data, std::vector<std::size_t>&& row_offsets)
+      : m_data(std::move(data)), m_row_offsets(std::move(row_offsets)) {
+    if (m_row_offsets.empty() || m_row_offsets.front() != 0 ||
+        m_row_offsets.back() != m_data.size()) {
+      throw std::invalid_argument("JaggedArray - Row offsets do not match the data size.");
+    }
+  }
+
   JaggedArray(const JaggedArray& other) = default;
   JaggedArray(JaggedArray&& other) noexcept = default;
   JaggedArray& operator=(const JaggedArray& other) = default;
@@ -100,6 +114,10 @@ class JaggedArray {
 
   std::size_t total_elements() const noexcept { return m_data.size(); }
 
+  std::span<T> data() noexcept { return m_data; }
+  std::span<const T> data() const noexcept { return m_data; }
+  std::span<const std::size_t> row_offsets() const noexcept { return m_row_offsets; }
+
   std::span<T> operator[](std::size_t r_idx) {
     if (r_idx >= num_rows()) {
       throw std::out_of_range("JaggedArray::operator[] - Row index (" + std::to_string(r_idx) +
@@ -245,10 +263,11 @@ class JaggedArray {
         typename std::conditional<IsConstIter, const JaggedArray<T>*, JaggedArray<T>*>::type;
 
    private:
-    ParentArrayPtr m_parent_array;
-    std::size_t m_current_row_idx;
+    ParentArrayPtr m_parent_array = nullptr;
+    std::size_t m_current_row_idx = 0;
 
    public:
+    RowIterator() = default;
     RowIterator(ParentArrayPtr parent, std::size_t r_idx)
         : m_parent_array(parent), m_current_row_idx(r_idx) {}
 
@@ -9,10 +9,20 @@
 #include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
 #include <limits>
 #include <ranges>
+#include <span>
+#include <stdexcept>
+#include <vector>
 #include <xtensor/containers/xarray.hpp>
 
+#if __has_include(<experimental/simd>) && !defined(OISEAU_SCALAR_MATH)
+#include <experimental/simd>
+/// Defined when the polynomial evaluations use `std::experimental::simd`.
+#define OISEAU_SIMD_MATH 1
+#endif
+
 namespace oiseau::utils {
 
 /// Concept that checks for contiguous floating-point containers.
@@ -20,23 +30,62 @@ template <class Container>
 concept FloatingArrayLike = std::ranges::contiguous_range<Container> &&
                             std::is_floating_point_v<std::ranges::range_value_t<Container>>;
 
-/// Computes the Jacobi polynomial P_n^{(alpha,beta)}(x) at a single point.
-template <std::floating_point Real>
-Real jacobi(unsigned n, Real alpha, Real beta, Real x) {
+namespace detail {
+
+#ifdef OISEAU_SIMD_MATH
+template <class Real>
+using simd = std::experimental::native_simd<Real>;
+#endif
+
+/**
+ * @brief Replaces every value `x` of `values` by `f(x)`, several values at a time.
+ *
+ * `f` is called with `detail::simd<Real>` vectors; the last vector is padded with zeros, so
+ * every value goes through the same instructions whatever its position. Without
+ * `<experimental/simd>`, or with `OISEAU_SCALAR_MATH` defined, `f` is called with `Real`.
+ */
+template <std::floating_point Real, class F>
+void transform_lanes(std::span<Real> values, F&& f) {
+#ifdef OISEAU_SIMD_MATH
+  namespace stdx = std::experimental;
+  constexpr std::size_t lanes = simd<Real>::size();
+  for (std::size_t i = 0; i < values.size(); i += lanes) {
+    const std::size_t m = std::min(lanes, values.size() - i);
+    alignas(stdx::memory_alignment_v<simd<Real>>) Real buffer[lanes] = {};
+    std::copy_n(values.data() + i, m, buffer);
+    const simd<Real> y = f(simd<Real>(buffer, stdx::vector_aligned));
+    y.copy_to(buffer, stdx::vector_aligned);
+    std::copy_n(buffer, m, values.data() + i);
+  }
+#else
+  for (Real& x : values) x = f(x);
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief Computes the Jacobi polynomial P_n^{(alpha,beta)}(x) at a single point.
+ *
+ * `Value` may also be a `detail::simd<Real>` vector, evaluated lane by lane with the same
+ * operations as a scalar point.
+ */
+template <std::floating_point Real, class Value = Real>
+Value jacobi(unsigned n, Real alpha, Real beta, Value x) {
   if (n == 0) {
-    return Real(1);
+    return Value(Real(1));
   }
 
-  Real y0 = 1;
-  Real y1 = (alpha + 1) + (alpha + beta + 2) * (x - 1) / Real(2);
+  Value y0(Real(1));
+  Value y1 = (alpha + 1) + (alpha + beta + 2) * (x - 1) / Real(2);
 
-  Real yk = y1;
+  Value yk = y1;
   unsigned k = 2;
   Real k_max = n * (1 + std::numeric_limits<Real>::epsilon());
 
   while (k < k_max) {
     Real denom = 2 * k * (k + alpha + beta) * (2 * k + alpha + beta - 2);
-    Real gamma1 =
+    Value gamma1 =
         (2 * k + alpha + beta - 1) *
         ((2 * k + alpha + beta) * (2 * k + alpha + beta - 2) * x + alpha * alpha - beta * beta);
     Real gamma0 = -2 * (k + alpha - 1) * (k + beta - 1) * (2 * k + alpha + beta);
@@ -48,17 +97,18 @@ Real jacobi(unsigned n, Real alpha, Real beta, Real x) {
   return yk;
 }
 
-/// Computes the normalized Jacobi polynomial at each entry of a container.
+/// Computes the normalized Jacobi polynomial at each entry of a container, vectorized.
 template <std::floating_point Real, FloatingArrayLike Container>
 Container jacobi_p(unsigned n, Real alpha, Real beta, const Container& input) {
   Container v = input;
   Real norm = std::pow(2, alpha + beta + 1) / (2 * n + alpha + beta + 1);
   norm *= std::tgamma(n + alpha + 1) * std::tgamma(n + beta + 1);
   norm /= (std::tgamma(n + 1) * std::tgamma(n + alpha + beta + 1));
-  auto partial = [n, alpha, beta, norm](auto& k) {
-    k = jacobi(n, alpha, beta, k) / std::sqrt(norm);
-  };
-  std::for_each(v.begin(), v.end(), partial);
+  const Real sqrt_norm = std::sqrt(norm);
+  detail::transform_lanes(std::span<Real>(std::ranges::data(v), std::ranges::size(v)),
+                          [n, alpha, beta, sqrt_norm](auto x) {
+                            return jacobi(n, alpha, beta, x) / sqrt_norm;
+                          });
   return v;
 }
 
@@ -76,4 +126,97 @@ Container grad_jacobi_p(int n, Real alpha, Real beta, const Container& input) {
   return output;
 }
 
+/**
+ * @class JacobiRecurrence
+ * @brief Normalized Jacobi polynomials of all degrees from 0 to n in one sweep.
+ *
+ * Holds the three-term recurrence of the orthonormal polynomials P_k^{(alpha,beta)}, so the
+ * normalization constants and coefficients are computed once per (n, alpha, beta) rather than
+ * for every degree and point. Evaluating every degree costs as much as one `jacobi_p` of
+ * degree n, and matches `jacobi_p` up to rounding.
+ */
+template <std::floating_point Real>
+class JacobiRecurrence {
+ public:
+  JacobiRecurrence(unsigned n, Real alpha, Real beta) : m_n(n), m_a(n + 1), m_b(n + 1) {
+    const Real ab = alpha + beta;
+    Real gamma0 = std::pow(Real(2), ab + 1) / (ab + 1);
+    gamma0 *= std::tgamma(alpha + 1) * std::tgamma(beta + 1) / std::tgamma(ab + 1);
+    m_p0 = 1 / std::sqrt(gamma0);
+    if (n == 0) return;
+    m_a[1] = 2 / (ab + 2) * std::sqrt((alpha + 1) * (beta + 1) / (ab + 3));
+    m_b[0] = (beta - alpha) / (ab + 2);
+    for (unsigned k = 1; k < n; ++k) {
+      const Real h = 2 * k + ab;
+      m_a[k + 1] = 2 / (h + 2) *
+                   std::sqrt((k + 1) * (k + 1 + ab) * (k + 1 + alpha) * (k + 1 + beta) /
+                             ((h + 1) * (h + 3)));
+      m_b[k] = (beta * beta - alpha * alpha) / (h * (h + 2));
+    }
+  }
+
+  inline unsigned degree() const { return m_n; }
+
+  /// Writes P_k(x[i]) to `out[k * x.size() + i]` for k = 0, ..., n.
+  void evaluate(std::span<const Real> x, std::span<Real> out) const {
+    const std::size_t m = x.size();
+    if (out.size() != (m_n + std::size_t{1}) * m) {
+      throw std::invalid_argument("JacobiRecurrence: output size must be (n + 1) * points");
+    }
+    for (std::size_t i = 0; i < m; ++i) out[i] = m_p0;
+    if (m_n == 0) return;
+    const Real a1 = 1 / m_a[1];
+    for (std::size_t i = 0; i < m; ++i) out[m + i] = (x[i] - m_b[0]) * m_p0 * a1;
+    for (unsigned k = 1; k < m_n; ++k) {
+      const Real* pm = out.data() + (k - 1) * m;
+      const Real* pk = out.data() + k * m;
+      Real* pn = out.data() + (k + 1) * m;
+      const Real inv_a = 1 / m_a[k + 1];
+      const Real a = m_a[k];
+      const Real b = m_b[k];
+      for (std::size_t i = 0; i < m; ++i) pn[i] = ((x[i] - b) * pk[i] - a * pm[i]) * inv_a;
+    }
+  }
+
+ private:
+  unsigned m_n;
+  Real m_p0;               ///< The constant P_0.
+  std::vector<Real> m_a;   ///< `m_a[k]`: coefficient of P_k in x P_{k-1}.
+  std::vector<Real> m_b;   ///< `m_b[k]`: coefficient of P_k in x P_k.
+};
+
+/**
+ * @brief Normalized Jacobi polynomials of degrees 0 to n at each entry of a container.
+ * @return An `(n + 1) × size` array; row k holds degree k.
+ */
+template <std::floating_point Real, FloatingArrayLike Container>
+xt::xarray<Real> jacobi_p_table(unsigned n, Real alpha, Real beta, const Container& input) {
+  const std::size_t m = std::ranges::size(input);
+  xt::xarray<Real> out = xt::xarray<Real>::from_shape({std::size_t{n} + 1, m});
+  JacobiRecurrence<Real>(n, alpha, beta)
+      .evaluate({std::ranges::data(input), m}, {out.data(), out.size()});
+  return out;
+}
+
+/**
+ * @brief Gradients of the normalized Jacobi polynomials of degrees 0 to n.
+ * @return An `(n + 1) × size` array; row k holds the derivative of degree k.
+ */
+template <std::floating_point Real, FloatingArrayLike Container>
+xt::xarray<Real> grad_jacobi_p_table(unsigned n, Real alpha, Real beta, const Container& input) {
+  const std::size_t m = std::ranges::size(input);
+  xt::xarray<Real> out = xt::xarray<Real>::from_shape({std::size_t{n} + 1, m});
+  std::fill_n(out.data(), m, Real(0));
+  if (n == 0) return out;
+  // d/dx P_k^{(a,b)} = sqrt(k (k + a + b + 1)) P_{k-1}^{(a+1,b+1)}.
+  JacobiRecurrence<Real>(n - 1, alpha + 1, beta + 1)
+      .evaluate({std::ranges::data(input), m}, {out.data() + m, n * m});
+  for (unsigned k = 1; k <= n; ++k) {
+    const Real norm = std::sqrt(k * (k + alpha + beta + 1));
+    Real* row = out.data() + k * m;
+    for (std::size_t i = 0; i < m; ++i) row[i] *= norm;
+  }
+  return out;
+}
+
 }  // namespace oiseau::utils
@@ -16,6 +16,7 @@ namespace std {
 using Kokkos::dextents;
 using Kokkos::extents;
 using Kokkos::layout_right;
+using Kokkos::layout_stride;
 using Kokkos::mdspan;
 }  // namespace std
 #endif
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/utils/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+namespace oiseau::utils {
+
+ThreadPool::ThreadPool(std::size_t n_threads) {
+  if (n_threads == 0) n_threads = std::max(1u, std::thread::hardware_concurrency());
+  m_workers.reserve(n_threads);
+  for (std::size_t i = 0; i < n_threads; ++i) {
+    m_workers.emplace_back([this](std::stop_token stop) { worker_loop(stop); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  for (auto& worker : m_workers) worker.request_stop();
+  m_cv.notify_all();
+  m_workers.clear();
+}
+
+bool ThreadPool::run_pending_task() {
+  std::function<void()> task;
+  {
+    std::lock_guard lock(m_mutex);
+    if (m_tasks.empty()) return false;
+    task = std::move(m_tasks.front());
+    m_tasks.pop();
+  }
+  task();
+  return true;
+}
+
+void ThreadPool::worker_loop(std::stop_token stop) {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(m_mutex);
+      if (!m_cv.wait(lock, stop, [this] { return !m_tasks.empty(); })) return;
+      task = std::move(m_tasks.front());
+      m_tasks.pop();
+    }
+    task();
+  }
+}
+
+ThreadPool& default_thread_pool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+}  // namespace oiseau::utils
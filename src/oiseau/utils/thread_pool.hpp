@@ -0,0 +1,129 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace oiseau::utils {
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size set of worker threads consuming a FIFO task queue.
+ *
+ * Threads waiting on results of the pool (see `wait`) execute queued tasks themselves, so
+ * tasks may safely submit and wait on further tasks without deadlocking the pool.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Starts the worker threads.
+   * @param n_threads Number of workers; zero selects `std::thread::hardware_concurrency()`.
+   */
+  explicit ThreadPool(std::size_t n_threads = 0);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  inline std::size_t size() const { return m_workers.size(); }
+
+  /**
+   * @brief Queues a callable for execution on a worker thread.
+   * @return A future holding the result (or the exception) of the callable.
+   */
+  template <class F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& f) {
+    using R = std::invoke_result_t<std::decay_t<F>>;
+    auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+    auto future = task->get_future();
+    {
+      std::lock_guard lock(m_mutex);
+      m_tasks.emplace([task] { (*task)(); });
+    }
+    m_cv.notify_one();
+    return future;
+  }
+
+  /**
+   * @brief Runs one queued task on the calling thread.
+   * @return False if the queue was empty.
+   */
+  bool run_pending_task();
+
+  /// Blocks until `future` is ready, running queued tasks in the meantime.
+  template <class T>
+  T wait(std::future<T>& future) {
+    using namespace std::chrono_literals;
+    while (future.wait_for(0s) != std::future_status::ready) {
+      if (!run_pending_task()) future.wait_for(1ms);
+    }
+    return future.get();
+  }
+
+ private:
+  void worker_loop(std::stop_token stop);
+
+  std::mutex m_mutex;
+  std::condition_variable_any m_cv;
+  std::queue<std::function<void()>> m_tasks;
+  std::vector<std::jthread> m_workers;
+};
+
+/// Process-wide pool shared by the library's parallel kernels.
+ThreadPool& default_thread_pool();
+
+/**
+ * @brief Calls `f(i)` for every `i` in `[0, n)` on the default thread pool.
+ *
+ * Indices are grouped into contiguous chunks of at least `grain` entries. The calling thread
+ * takes part in the work; the first exception thrown by `f` is rethrown once all chunks finish.
+ */
+template <class F>
+void parallel_for(std::size_t n, F&& f, std::size_t grain = 1) {
+  if (n == 0) return;
+  ThreadPool& pool = default_thread_pool();
+  grain = std::max<std::size_t>(grain, 1);
+  const std::size_t max_chunks = std::max<std::size_t>(1, 4 * pool.size());
+  const std::size_t n_chunks = std::min(max_chunks, (n + grain - 1) / grain);
+  if (n_chunks <= 1) {
+    for (std::size_t i = 0; i < n; ++i) f(i);
+    return;
+  }
+  const std::size_t chunk = (n + n_chunks - 1) / n_chunks;
+  std::vector<std::future<void>> futures;
+  futures.reserve(n_chunks);
+  for (std::size_t begin = 0; begin < n; begin += chunk) {
+    const std::size_t end = std::min(n, begin + chunk);
+    futures.emplace_back(pool.submit([&f, begin, end] {
+      for (std::size_t i = begin; i < end; ++i) f(i);
+    }));
+  }
+  std::exception_ptr error;
+  for (auto& future : futures) {
+    try {
+      pool.wait(future);
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace oiseau::utils
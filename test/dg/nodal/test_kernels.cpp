@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/kernels.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/test_macros.hpp"
+
+using oiseau::dg::nodal::BlockOperators;
+using oiseau::dg::nodal::GemmBackend;
+using oiseau::dg::nodal::RefElementType;
+
+namespace {
+
+/// `n_elements` elements of `n` smooth, distinct values each.
+std::vector<double> block_values(std::size_t n_elements, std::size_t n) {
+  std::vector<double> values(n_elements * n);
+  for (std::size_t i = 0; i < values.size(); ++i) values[i] = std::sin(0.1 * i);
+  return values;
+}
+
+/// Applies `a` to every element of `x` through xtensor.
+std::vector<double> reference_apply(const xt::xarray<double>& a, const std::vector<double>& x) {
+  const std::size_t rows = a.shape()[0];
+  const std::size_t cols = a.shape()[1];
+  std::vector<double> y;
+  for (std::size_t e = 0; e < x.size() / cols; ++e) {
+    xt::xarray<double> xe = xt::zeros<double>({cols});
+    std::copy_n(x.begin() + e * cols, cols, xe.begin());
+    const xt::xarray<double> ye = xt::linalg::dot(a, xe);
+    y.insert(y.end(), ye.begin(), ye.end());
+    EXPECT_EQ(ye.size(), rows);
+  }
+  return y;
+}
+
+}  // namespace
+
+TEST(test_kernels, block_operators_match_xtensor) {
+  // Direct and blocked specialized kernels, and the generic kernel above order 10.
+  const std::vector<std::tuple<RefElementType, unsigned, bool>> cases = {
+      {RefElementType::Line, 2, true},
+      {RefElementType::Triangle, 3, true},
+      {RefElementType::Hexahedron, 2, true},
+      {RefElementType::Quadrilateral, 11, false}};
+  for (const auto& [type, order, specialized] : cases) {
+    const BlockOperators ops(type, order);
+    const auto& ref = ops.reference();
+    EXPECT_EQ(ops.specialized(), specialized);
+    const std::size_t np = ref.number_of_nodes();
+    const std::size_t n_elements = 19;  // Not a multiple of the block size.
+    const std::vector<double> u = block_values(n_elements, np);
+    std::vector<double> out(n_elements * np);
+
+    ops.mass(u, out);
+    std::vector<double> expected = reference_apply(ref.mass(), u);
+    EXPECT_FLOATS_NEARLY_EQ(expected, out, 1e-10);
+    ops.inv_mass(u, out);
+    expected = reference_apply(ref.inv_mass(), u);
+    EXPECT_FLOATS_NEARLY_EQ(expected, out, 1e-10);
+    const std::size_t n_axes = ref.d().dimension() == 2 ? 1 : ref.d().shape()[2];
+    for (std::size_t axis = 0; axis < n_axes; ++axis) {
+      ops.d(axis, u, out);
+      const xt::xarray<double> d =
+          n_axes == 1 ? ref.d() : xt::xarray<double>(xt::view(ref.d(), xt::all(), xt::all(), axis));
+      expected = reference_apply(d, u);
+      EXPECT_FLOATS_NEARLY_EQ(expected, out, 1e-10);
+    }
+
+    const std::vector<double> flux = block_values(n_elements, ref.lift().shape()[1]);
+    ops.lift(flux, out);
+    expected = reference_apply(ref.lift(), flux);
+    EXPECT_FLOATS_NEARLY_EQ(expected, out, 1e-10);
+  }
+}
+
+TEST(test_kernels, batched_backends_match_xtensor) {
+  // Large enough to be split across several chunks of the thread pool.
+  const std::size_t n_elements = 2000;
+  std::vector<GemmBackend> backends = {GemmBackend::Kernels};
+  if (oiseau::dg::nodal::has_blas_backend()) {
+    backends.push_back(GemmBackend::Blas);
+  } else {
+    EXPECT_THROW(BlockOperators(RefElementType::Tetrahedron, 3, GemmBackend::Blas),
+                 std::invalid_argument);
+  }
+  for (const GemmBackend backend : backends) {
+    const BlockOperators ops(RefElementType::Tetrahedron, 3, backend);
+    const auto& ref = ops.reference();
+    const std::vector<double> u = block_values(n_elements, ref.number_of_nodes());
+    std::vector<double> out(u.size());
+    ops.mass(u, out);
+    expect_near(reference_apply(ref.mass(), u), out);
+
+    const std::vector<double> flux = block_values(n_elements, ref.lift().shape()[1]);
+    ops.lift(flux, out);
+    expect_near(reference_apply(ref.lift(), flux), out);
+  }
+}
+
+TEST(test_kernels, block_operators_reject_bad_input) {
+  const BlockOperators ops(RefElementType::Triangle, 2);
+  std::vector<double> u(12), out(12);
+  EXPECT_NO_THROW(ops.mass(u, out));
+  EXPECT_THROW(ops.mass(std::vector<double>(7), out), std::invalid_argument);
+  EXPECT_THROW(ops.d(2, u, out), std::invalid_argument);
+
+  const BlockOperators prism(RefElementType::Prism, 1);
+  EXPECT_THROW(prism.lift(u, out), std::invalid_argument);
+}
@@ -6,17 +6,106 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/core/xmath.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/views/xview.hpp>
 
 #include "oiseau/dg/nodal/ref_element.hpp"
 #include "oiseau/dg/nodal/ref_line.hpp"
 #include "oiseau/test_macros.hpp"
 
+using oiseau::dg::nodal::get_ref_element;
 using oiseau::dg::nodal::RefElement;
+using oiseau::dg::nodal::RefElementType;
 using oiseau::dg::nodal::RefLine;
 using std::unique_ptr;
 
 TEST(test_ref_element, invalid_order) {
   EXPECT_THROW({ std::make_unique<RefLine>(0); }, std::invalid_argument);
 }
+
+TEST(test_ref_element, mass_operators) {
+  // Reference volume of each element type.
+  const std::vector<std::tuple<RefElementType, double>> types = {
+      {RefElementType::Line, 2.0},
+      {RefElementType::Triangle, 2.0},
+      {RefElementType::Quadrilateral, 4.0},
+      {RefElementType::Tetrahedron, 4.0 / 3.0},
+      {RefElementType::Hexahedron, 8.0},
+      {RefElementType::Prism, 4.0},
+      {RefElementType::Pyramid, 8.0 / 3.0}};
+  for (const auto& [type, volume] : types) {
+    for (unsigned order = 1; order <= 3; ++order) {
+      const auto ref = get_ref_element(type, order);
+      const xt::xarray<double> identity = xt::eye<double>(ref->number_of_nodes());
+      const xt::xarray<double> product = xt::linalg::dot(ref->mass(), ref->inv_mass());
+      EXPECT_TRUE(xt::allclose(product, identity, 0.0, 1e-8));
+      EXPECT_NEAR(xt::sum(ref->mass())(), volume, 1e-10);
+    }
+  }
+}
+
+TEST(test_ref_element, face_operators) {
+  // Number of faces and the reference measure of each face.
+  const std::vector<std::tuple<RefElementType, std::size_t, double>> types = {
+      {RefElementType::Line, 2, 1.0},
+      {RefElementType::Triangle, 3, 2.0},
+      {RefElementType::Quadrilateral, 4, 2.0},
+      {RefElementType::Tetrahedron, 4, 2.0},
+      {RefElementType::Hexahedron, 6, 4.0}};
+  for (const auto& [type, n_faces, measure] : types) {
+    for (unsigned order = 1; order <= 3; ++order) {
+      const auto ref = get_ref_element(type, order);
+      const std::size_t np = ref->number_of_nodes();
+      const std::size_t nfp = ref->number_of_face_nodes();
+      ASSERT_EQ(ref->fmask().shape()[0], n_faces);
+      ASSERT_EQ(ref->fmask().shape()[1], nfp);
+      ASSERT_EQ(ref->lift().shape()[0], np);
+      ASSERT_EQ(ref->lift().shape()[1], n_faces * nfp);
+
+      // M LIFT scatters each face mass matrix to the rows of the face nodes.
+      const xt::xarray<double> emat = xt::linalg::dot(ref->mass(), ref->lift());
+      xt::xarray<double> expected = xt::zeros<double>({np, n_faces * nfp});
+      for (std::size_t f = 0; f < n_faces; ++f) {
+        const xt::xarray<double> face_mass = xt::view(ref->face_mass(), f, xt::all(), xt::all());
+        EXPECT_NEAR(xt::sum(face_mass)(), measure, 1e-10);
+        for (std::size_t i = 0; i < nfp; ++i) {
+          for (std::size_t j = 0; j < nfp; ++j) {
+            expected(ref->fmask()(f, i), f * nfp + j) = face_mass(i, j);
+          }
+        }
+      }
+      EXPECT_TRUE(xt::allclose(emat, expected, 0.0, 1e-8));
+    }
+  }
+}
+
+TEST(test_ref_element, packed_operators) {
+  for (const auto type : {RefElementType::Line, RefElementType::Triangle,
+                          RefElementType::Tetrahedron, RefElementType::Hexahedron}) {
+    const auto ref = get_ref_element(type, 3);
+    const auto& packed = ref->packed();
+    const std::size_t np = ref->number_of_nodes();
+    ASSERT_EQ(packed.d.size(), ref->d().dimension() == 2 ? 1 : ref->d().shape()[2]);
+    ASSERT_EQ(packed.lift.cols(), ref->lift().shape()[1]);
+    for (std::size_t axis = 0; axis < packed.d.size(); ++axis) {
+      const auto d = packed.d[axis].view();
+      EXPECT_EQ(reinterpret_cast<std::uintptr_t>(d.data_handle()) % 64, 0);
+      EXPECT_EQ(d.stride(0) % 8, 0);
+      for (std::size_t i = 0; i < np; ++i) {
+        for (std::size_t j = 0; j < np; ++j) {
+          const double expected = packed.d.size() == 1 ? ref->d()(i, j) : ref->d()(i, j, axis);
+          EXPECT_EQ((d[i, j]), expected);
+          EXPECT_EQ(packed.mass(i, j), ref->mass()(i, j));
+        }
+      }
+    }
+  }
+}
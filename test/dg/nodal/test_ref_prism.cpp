@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/core/xmath.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/ref_prism.hpp"
+#include "oiseau/test_macros.hpp"
+
+TEST(test_ref_prism, get_number_of_nodes) {
+  for (unsigned order = 1; order <= 5; ++order) {
+    auto ref = oiseau::dg::nodal::RefPrism(order);
+    unsigned n = (order + 1) * (order + 1) * (order + 2) / 2;
+    EXPECT_EQ(ref.number_of_nodes(), n);
+    EXPECT_EQ(ref.r().shape()[0], n);
+  }
+}
+
+TEST(test_ref_prism, vandermonde_interpolation) {
+  for (unsigned order = 2; order <= 4; ++order) {
+    auto coarse_ref = oiseau::dg::nodal::RefPrism(order);
+    auto fine_ref = oiseau::dg::nodal::RefPrism(order + 2);
+    const oiseau::dg::nodal::RefElement &coarse = coarse_ref;
+
+    auto V_coarse = coarse_ref.v();
+    auto V_fine = coarse.vandermonde(fine_ref.r());
+
+    // Function at coarse nodes: f(r, s, t) = r² + s t + t²
+    auto r_coarse = xt::col(coarse_ref.r(), 0);
+    auto s_coarse = xt::col(coarse_ref.r(), 1);
+    auto t_coarse = xt::col(coarse_ref.r(), 2);
+    auto f_coarse = xt::pow(r_coarse, 2) + s_coarse * t_coarse + xt::pow(t_coarse, 2);
+
+    auto AT = xt::linalg::solve(xt::transpose(V_coarse), xt::transpose(V_fine));
+    auto interpolated = xt::linalg::dot(xt::transpose(AT), f_coarse);
+
+    auto r_fine = xt::col(fine_ref.r(), 0);
+    auto s_fine = xt::col(fine_ref.r(), 1);
+    auto t_fine = xt::col(fine_ref.r(), 2);
+    auto f_fine_exact = xt::pow(r_fine, 2) + s_fine * t_fine + xt::pow(t_fine, 2);
+
+    EXPECT_FLOATS_NEARLY_EQ(interpolated, f_fine_exact, 1e-10);
+  }
+}
+
+TEST(test_ref_prism, differentiation_is_exact_for_polynomials) {
+  for (unsigned order = 2; order <= 4; ++order) {
+    auto ref = oiseau::dg::nodal::RefPrism(order);
+    xt::xarray<double> r = xt::col(ref.r(), 0);
+    xt::xarray<double> s = xt::col(ref.r(), 1);
+    xt::xarray<double> t = xt::col(ref.r(), 2);
+    xt::xarray<double> f = r * s + xt::pow(t, 2);
+
+    xt::xarray<double> dr = xt::view(ref.d(), xt::all(), xt::all(), 0);
+    xt::xarray<double> ds = xt::view(ref.d(), xt::all(), xt::all(), 1);
+    xt::xarray<double> dt = xt::view(ref.d(), xt::all(), xt::all(), 2);
+
+    xt::xarray<double> dfdr = xt::linalg::dot(dr, f);
+    xt::xarray<double> dfds = xt::linalg::dot(ds, f);
+    xt::xarray<double> dfdt = xt::linalg::dot(dt, f);
+    EXPECT_FLOATS_NEARLY_EQ(dfdr, s, 1e-9);
+    EXPECT_FLOATS_NEARLY_EQ(dfds, r, 1e-9);
+    xt::xarray<double> two_t = 2 * t;
+    EXPECT_FLOATS_NEARLY_EQ(dfdt, two_t, 1e-9);
+  }
+}
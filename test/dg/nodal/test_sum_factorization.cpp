@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/nodal/kernels.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/sum_factorization.hpp"
+#include "oiseau/test_macros.hpp"
+
+using oiseau::dg::nodal::BlockOperators;
+using oiseau::dg::nodal::RefElementType;
+using oiseau::dg::nodal::TensorOperators;
+
+TEST(test_sum_factorization, matches_dense_operators) {
+  const std::vector<std::pair<RefElementType, unsigned>> cases = {
+      {RefElementType::Quadrilateral, 3},
+      {RefElementType::Hexahedron, 2},
+      {RefElementType::Hexahedron, 4}};
+  for (const auto& [type, order] : cases) {
+    const TensorOperators tensor(type, order);
+    const BlockOperators dense(type, order);
+    const std::size_t np = dense.reference().number_of_nodes();
+    ASSERT_EQ(tensor.number_of_nodes(), np);
+    const std::size_t n_elements = 5;
+    std::vector<double> u(n_elements * np);
+    for (std::size_t i = 0; i < u.size(); ++i) u[i] = std::cos(0.3 * i);
+    std::vector<double> expected(u.size()), actual(u.size());
+
+    for (std::size_t axis = 0; axis < tensor.dimension(); ++axis) {
+      dense.d(axis, u, expected);
+      tensor.d(axis, u, actual);
+      EXPECT_FLOATS_NEARLY_EQ(expected, actual, 1e-10);
+    }
+    dense.mass(u, expected);
+    tensor.mass(u, actual);
+    EXPECT_FLOATS_NEARLY_EQ(expected, actual, 1e-10);
+    dense.inv_mass(u, expected);
+    tensor.inv_mass(u, actual);
+    EXPECT_FLOATS_NEARLY_EQ(expected, actual, 1e-10);
+  }
+}
+
+TEST(test_sum_factorization, rejects_bad_input) {
+  EXPECT_THROW(TensorOperators(RefElementType::Triangle, 2), std::invalid_argument);
+  const TensorOperators ops(RefElementType::Quadrilateral, 2);
+  std::vector<double> u(18), out(18);
+  EXPECT_NO_THROW(ops.mass(u, out));
+  EXPECT_THROW(ops.mass(std::vector<double>(7), out), std::invalid_argument);
+  EXPECT_THROW(ops.d(2, u, out), std::invalid_argument);
+}
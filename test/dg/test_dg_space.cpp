@@ -0,0 +1,107 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
+using oiseau::dg::DGSpace;
+using oiseau::mesh::CellKind;
+
+namespace {
+
+/// Height of the midpoint of the curved edge.
+constexpr double bulge = 0.25;
+
+/// The curved edge runs from (0, 0) to (2, 0) along this parabola.
+double parabola(double x) { return bulge * x * (2.0 - x); }
+
+/**
+ * A single cell whose vertices are the first `n_vertices` nodes of `x` (two coordinates each);
+ * the remaining nodes make it curved when `curved` is set.
+ */
+oiseau::mesh::Mesh make_cell(CellKind kind, std::vector<double> x, std::size_t n_vertices,
+                             bool curved) {
+  const std::size_t n_nodes = x.size() / 2;
+  std::vector<std::size_t> vertices;
+  std::vector<std::size_t> high_order;
+  for (std::size_t i = 0; i < n_nodes; ++i) (i < n_vertices ? vertices : high_order).push_back(i);
+  oiseau::mesh::Topology topology(
+      oiseau::utils::JaggedArray<std::size_t>(std::move(vertices), {0, n_vertices}),
+      {oiseau::mesh::get_cell_type(kind)});
+  if (!curved) return {std::move(topology), oiseau::mesh::Geometry(std::move(x), 2)};
+  oiseau::utils::JaggedArray<std::size_t> rows(std::move(high_order), {0, n_nodes - n_vertices});
+  return {std::move(topology), oiseau::mesh::Geometry(std::move(x), 2, std::move(rows))};
+}
+
+struct CurvedCell {
+  CellKind kind;
+  std::vector<double> x;
+  std::size_t n_vertices;
+};
+
+/// A 6-node triangle and a 9-node quadrilateral sharing the curved edge, nodes in gmsh order.
+const std::vector<CurvedCell> curved_cells = {
+    {CellKind::Triangle, {0, 0, 2, 0, 0, 2, 1, bulge, 1, 1, 0, 1}, 3},
+    {CellKind::Quadrilateral, {0, 0, 2, 0, 2, 2, 0, 2, 1, bulge, 2, 1, 1, 2, 0, 1, 1, 1}, 4},
+};
+
+}  // namespace
+
+TEST(test_dg_space, curved_edge_nodes_follow_the_geometry) {
+  for (const auto& [kind, x, n_vertices] : curved_cells) {
+    const oiseau::mesh::Mesh mesh = make_cell(kind, x, n_vertices, true);
+    for (unsigned order : {2u, 4u}) {
+      const DGSpace space(mesh, {order});
+      const auto& element = space.elements()[0];
+      const auto& r = element.reference().r();
+      const auto& nodes = element.nodes();
+      std::size_t on_edge = 0;
+      for (std::size_t i = 0; i < element.reference().number_of_nodes(); ++i) {
+        // The curved edge is the image of the reference edge s = -1.
+        if (std::abs(r(i, 1) + 1.0) > 1e-10) continue;
+        ++on_edge;
+        EXPECT_NEAR(nodes(i, 1), parabola(nodes(i, 0)), 1e-12);
+      }
+      EXPECT_EQ(on_edge, order + 1);
+    }
+  }
+}
+
+TEST(test_dg_space, first_order_geometry_is_affine) {
+  for (const auto& [kind, x, n_vertices] : curved_cells) {
+    const oiseau::mesh::Mesh mesh = make_cell(kind, x, n_vertices, false);
+    const DGSpace space(mesh, {3});
+    const auto& element = space.elements()[0];
+    const auto& r = element.reference().r();
+    const auto& nodes = element.nodes();
+    for (std::size_t i = 0; i < element.reference().number_of_nodes(); ++i) {
+      const double a = r(i, 0);
+      const double b = r(i, 1);
+      // Linear (triangle) or bilinear (quadrilateral) shape functions of the vertices.
+      const std::vector<double> shape =
+          kind == CellKind::Triangle
+              ? std::vector<double>{-(a + b) / 2, (1 + a) / 2, (1 + b) / 2}
+              : std::vector<double>{(1 - a) * (1 - b) / 4, (1 + a) * (1 - b) / 4,
+                                    (1 + a) * (1 + b) / 4, (1 - a) * (1 + b) / 4};
+      for (std::size_t d = 0; d < 2; ++d) {
+        double expected = 0.0;
+        for (std::size_t v = 0; v < n_vertices; ++v) expected += shape[v] * x[2 * v + d];
+        EXPECT_NEAR(nodes(i, d), expected, 1e-12);
+      }
+    }
+  }
+}
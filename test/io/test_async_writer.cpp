@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "oiseau/io/async_writer.hpp"
+#include "oiseau/io/xdmf.hpp"
+
+TEST(test_io, async_writer_copies_and_keeps_order) {
+  std::vector<std::pair<double, std::vector<double>>> written;
+  {
+    oiseau::io::AsyncSnapshotWriter writer(
+        [&](double time, std::span<const oiseau::io::XDMFField> fields) {
+          written.emplace_back(time, std::vector<double>(fields[0].values.begin(),
+                                                         fields[0].values.end()));
+        });
+    std::vector<double> u(100);
+    for (int step = 0; step < 20; ++step) {
+      std::fill(u.begin(), u.end(), step);
+      const std::vector<oiseau::io::XDMFField> fields = {{"u", u}};
+      writer.submit(step, fields);
+      // The solver may overwrite its buffer as soon as submit returns.
+      std::fill(u.begin(), u.end(), -1.0);
+    }
+    writer.flush();
+    EXPECT_EQ(written.size(), 20);
+    writer.submit(20, std::vector<oiseau::io::XDMFField>{{"u", u}});
+  }
+  // The destructor flushes the last snapshot.
+  ASSERT_EQ(written.size(), 21);
+  for (int step = 0; step < 20; ++step) {
+    EXPECT_EQ(written[step].first, step);
+    EXPECT_EQ(written[step].second, std::vector<double>(100, step));
+  }
+}
+
+TEST(test_io, async_writer_back_pressure_and_swap) {
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<int> count = 0;
+  oiseau::io::AsyncSnapshotWriter writer(
+      [&](double, std::span<const oiseau::io::XDMFField> fields) {
+        released.wait();
+        EXPECT_EQ(fields[0].values.size(), 3);
+        ++count;
+      },
+      {.num_buffers = 2, .num_threads = 1});
+
+  std::vector<oiseau::io::SnapshotField> fields = {{"u", {1, 2, 3}}};
+  writer.submit_swap(0.0, fields);
+  EXPECT_TRUE(fields.empty());  // the never-used storage of the slot
+  fields = {{"u", {4, 5, 6}}};
+  writer.submit_swap(1.0, fields);
+
+  // Both slots are in flight, so a third snapshot has to wait for the writer.
+  auto third = std::async(std::launch::async, [&] {
+    std::vector<oiseau::io::SnapshotField> more = {{"u", {7, 8, 9}}};
+    writer.submit_swap(2.0, more);
+    return more;
+  });
+  EXPECT_EQ(third.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+  release.set_value();
+  const auto recycled = third.get();
+  ASSERT_EQ(recycled.size(), 1);
+  // Either earlier snapshot may have been written by the time the third one got a slot.
+  EXPECT_EQ(recycled[0].values.size(), 3);
+  EXPECT_NE(recycled[0].values[0], 7.0);
+  writer.flush();
+  EXPECT_EQ(count, 3);
+}
+
+TEST(test_io, async_writer_reports_sink_errors) {
+  oiseau::io::AsyncSnapshotWriter writer(
+      [](double time, std::span<const oiseau::io::XDMFField>) {
+        if (time > 0) throw std::runtime_error("disk full");
+      },
+      {.num_buffers = 3, .num_threads = 2});
+  writer.submit(0.0, {});
+  writer.submit(1.0, {});
+  EXPECT_THROW(writer.flush(), std::runtime_error);
+  EXPECT_NO_THROW(writer.flush());
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/io/checkpoint.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
+namespace {
+
+std::filesystem::path temp_path(const std::string& name) {
+  return std::filesystem::temp_directory_path() / name;
+}
+
+}  // namespace
+
+TEST(test_io, checkpoint_sections_round_trip) {
+  using namespace oiseau::io::detail;
+  const auto path = temp_path("oiseau_test_checkpoint.ckpt");
+
+  // Enough values that the big section is copied in several chunks.
+  std::vector<double> big(3 << 20);
+  std::iota(big.begin(), big.end(), 0.0);
+  const std::vector<std::uint8_t> bytes = {1, 2, 3};
+  const std::vector<unsigned> head = {7, 8};
+  const std::vector<unsigned> tail = {9};
+  std::vector<CheckpointSection> sections;
+  sections.push_back(make_section<std::uint8_t>("bytes", bytes));
+  sections.push_back(make_section<double>("big", big, 3));
+  sections.push_back({"joined", SectionType::U32, 1, {std::as_bytes(std::span(head)),
+                                                       std::as_bytes(std::span(tail))}});
+  sections.push_back(make_section<double>("empty", {}));
+  write_checkpoint(path, 2.5, sections);
+  EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+
+  const CheckpointFile file(path);
+  EXPECT_EQ(file.time(), 2.5);
+  EXPECT_EQ(file.version(), 2);
+  ASSERT_EQ(file.sections().size(), 4);
+  for (const auto& section : file.sections()) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(section.data) % 64, 0) << section.name;
+  }
+  const auto read_bytes = file.get<std::uint8_t>("bytes");
+  EXPECT_EQ(std::vector<std::uint8_t>(read_bytes.begin(), read_bytes.end()), bytes);
+  const auto read_big = file.get<double>("big");
+  EXPECT_EQ(file.find("big")->components, 3);
+  ASSERT_EQ(read_big.size(), big.size());
+  EXPECT_TRUE(std::equal(big.begin(), big.end(), read_big.begin()));
+  const auto joined = file.get<std::uint32_t>("joined");
+  EXPECT_EQ(std::vector<std::uint32_t>(joined.begin(), joined.end()),
+            (std::vector<std::uint32_t>{7, 8, 9}));
+  EXPECT_TRUE(file.get<double>("empty").empty());
+  EXPECT_EQ(file.find("missing"), nullptr);
+  EXPECT_THROW(file.get<double>("bytes"), std::runtime_error);
+  EXPECT_THROW(file.get<double>("missing"), std::runtime_error);
+
+  EXPECT_THROW(write_checkpoint(path, 0.0, std::vector{sections[0], sections[0]}),
+               std::invalid_argument);
+  std::filesystem::remove(path);
+}
+
+TEST(test_io, checkpoint_rejects_damaged_files) {
+  using namespace oiseau::io::detail;
+  const auto path = temp_path("oiseau_test_checkpoint_damaged.ckpt");
+  const std::vector<double> values = {1.0, 2.0, 3.0};
+  write_checkpoint(path, 0.0, std::vector{make_section<double>("values", values)});
+  EXPECT_NO_THROW(CheckpointFile{path});
+
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+  EXPECT_THROW(CheckpointFile{path}, std::runtime_error);
+
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "not a checkpoint, but long enough to hold a header of sixty-four bytes....";
+  }
+  EXPECT_THROW(CheckpointFile{path}, std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(test_io, checkpoint_restarts_dg_space) {
+  using oiseau::mesh::CellKind;
+  using oiseau::mesh::get_cell_type;
+  const auto path = temp_path("oiseau_test_checkpoint_space.ckpt");
+  oiseau::mesh::Topology topology(
+      oiseau::utils::JaggedArray<std::size_t>{{0, 1, 2}, {0, 2, 3}, {1, 4, 5, 2}},
+      {get_cell_type(CellKind::Triangle), get_cell_type(CellKind::Triangle),
+       get_cell_type(CellKind::Quadrilateral)},
+      oiseau::mesh::FacetTable{
+          oiseau::utils::JaggedArray<std::size_t>{{0, 1}, {4, 5}},
+          {get_cell_type(CellKind::Interval), get_cell_type(CellKind::Interval)},
+          {7, -1}});
+  topology.set_cell_attributes({1, 1, 2}, {-3, 5, 6});
+  const oiseau::mesh::Mesh mesh(
+      std::move(topology), oiseau::mesh::Geometry({0, 0, 1, 0, 1, 1, 0, 1, 2, 0, 2, 1}, 2));
+  const oiseau::dg::DGSpace space(mesh, {1, 3, 2});
+  std::vector<double> element_nodes;
+  for (const auto& element : space.elements()) {
+    element_nodes.insert(element_nodes.end(), element.nodes().begin(), element.nodes().end());
+  }
+  std::vector<double> u(element_nodes.size() / 2);
+  std::iota(u.begin(), u.end(), 0.5);
+  const std::vector<oiseau::io::CheckpointField> fields = {{"u", u}};
+  oiseau::io::checkpoint_write(path, space, fields, 1.25);
+
+  const oiseau::io::Checkpoint restart(path);
+  EXPECT_EQ(restart.time(), 1.25);
+  const auto& read = restart.mesh();
+  const auto x = mesh.geometry().x();
+  const auto read_x = read.geometry().x();
+  EXPECT_EQ(read.geometry().dim(), 2);
+  EXPECT_EQ(std::vector<double>(read_x.begin(), read_x.end()),
+            std::vector<double>(x.begin(), x.end()));
+  ASSERT_EQ(read.topology().n_cells(), 3);
+  for (std::size_t i = 0; i < 3; ++i) {
+    const auto row = mesh.topology().conn()[i];
+    const auto read_row = read.topology().conn()[i];
+    EXPECT_EQ(std::vector<std::size_t>(read_row.begin(), read_row.end()),
+              std::vector<std::size_t>(row.begin(), row.end()));
+    EXPECT_EQ(read.topology().cell_types()[i], mesh.topology().cell_types()[i]);
+  }
+  const auto entity_tags = read.topology().entity_tags();
+  const auto physical_tags = read.topology().physical_tags();
+  EXPECT_EQ(std::vector<std::int32_t>(entity_tags.begin(), entity_tags.end()),
+            (std::vector<std::int32_t>{1, 1, 2}));
+  EXPECT_EQ(std::vector<std::int32_t>(physical_tags.begin(), physical_tags.end()),
+            (std::vector<std::int32_t>{-3, 5, 6}));
+  const auto& facets = read.topology().facets();
+  ASSERT_EQ(facets.size(), 2);
+  EXPECT_EQ(std::vector<std::size_t>(facets.conn[1].begin(), facets.conn[1].end()),
+            (std::vector<std::size_t>{4, 5}));
+  EXPECT_EQ(facets.cell_types[0], get_cell_type(CellKind::Interval));
+  EXPECT_EQ(facets.physical_tags, (std::vector<std::int32_t>{7, -1}));
+
+  const auto& read_space = restart.space();
+  EXPECT_EQ(std::vector<unsigned>(read_space.orders().begin(), read_space.orders().end()),
+            (std::vector<unsigned>{1, 3, 2}));
+  ASSERT_EQ(read_space.elements().size(), 3);
+  for (std::size_t i = 0; i < 3; ++i) {
+    const auto& expected = space.elements()[i].nodes();
+    const auto& actual = read_space.elements()[i].nodes();
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(actual.shape()[1], 2);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin()));
+    EXPECT_EQ(read_space.elements()[i].order(), space.elements()[i].order());
+  }
+  const auto read_u = restart.field("u");
+  EXPECT_EQ(read_u.components, 1);
+  EXPECT_EQ(std::vector<double>(read_u.values.begin(), read_u.values.end()), u);
+  EXPECT_EQ(restart.fields().size(), 1);
+  EXPECT_THROW(restart.field("v"), std::invalid_argument);
+  std::filesystem::remove(path);
+
+  // Adopted element nodes must match the orders exactly.
+  using oiseau::dg::DGSpace;
+  EXPECT_NO_THROW(DGSpace(mesh, {1, 3, 2}, element_nodes, 2));
+  EXPECT_THROW(DGSpace(mesh, {1, 3}, element_nodes, 2), std::invalid_argument);
+  EXPECT_THROW(DGSpace(mesh, {1, 3, 3}, element_nodes, 2), std::invalid_argument);
+  EXPECT_THROW(DGSpace(mesh, {1, 2, 2}, element_nodes, 2), std::invalid_argument);
+  EXPECT_THROW(DGSpace(mesh, {1, 3, 2}, std::span(element_nodes).first(element_nodes.size() - 2),
+                       2),
+               std::invalid_argument);
+}
@@ -6,14 +6,32 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include "oiseau/io/compressed_stream.hpp"
 #include "oiseau/io/gmsh.hpp"
+#include "oiseau/io/gmsh_file.hpp"
+#include "oiseau/io/gmsh_index.hpp"
+#include "oiseau/io/mapped_file.hpp"
 #include "oiseau/mesh/cell.hpp"
 #include "oiseau/mesh/mesh.hpp"
+#include "oiseau/test_utils.hpp"
+
+#ifdef OISEAU_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+using oiseau::test::append_binary;
 
 TEST(test_io, gmsh_read_from_string_3d_tetra_block) {
   std::string str =
@@ -50,8 +68,9 @@ $Elements
 5 4 5 7 8
 $EndElements)";
   oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
-  auto conn = mesh.topology().conn();
-  std::vector<std::vector<size_t>> actual(conn.begin(), conn.end());
+  const auto& conn = mesh.topology().conn();
+  std::vector<std::vector<size_t>> actual;
+  for (auto row : conn) actual.emplace_back(row.begin(), row.end());
   std::vector<std::vector<size_t>> expected = {
       {0, 1, 3, 4}, {1, 2, 3, 6}, {1, 3, 4, 6}, {1, 4, 5, 6}, {3, 4, 6, 7}};
   EXPECT_EQ(actual, expected);
@@ -105,8 +124,9 @@ $Elements
 3 6 3 9 12
 $EndElements)";
   oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
-  auto conn = mesh.topology().conn();
-  std::vector<std::vector<size_t>> actual(conn.begin(), conn.end());
+  const auto& conn = mesh.topology().conn();
+  std::vector<std::vector<size_t>> actual;
+  for (auto row : conn) actual.emplace_back(row.begin(), row.end());
   std::vector<std::vector<size_t>> expected = {
       {0, 1, 2, 3, 4, 5, 6, 7}, {1, 8, 2, 5}, {5, 2, 8, 11}};
   EXPECT_EQ(actual, expected);
@@ -117,5 +137,661 @@ TEST(test_io, gmsh_celltype_to_oiseau_celltype) {
             oiseau::mesh::get_cell_type(oiseau::mesh::CellKind::Point));
   EXPECT_EQ(oiseau::io::detail::gmsh_celltype_to_oiseau_celltype(2),
             oiseau::mesh::get_cell_type(oiseau::mesh::CellKind::Triangle));
+  EXPECT_EQ(oiseau::io::detail::gmsh_celltype_to_oiseau_celltype(6),
+            oiseau::mesh::get_cell_type(oiseau::mesh::CellKind::Prism));
+  EXPECT_EQ(oiseau::io::detail::gmsh_celltype_to_oiseau_celltype(7),
+            oiseau::mesh::get_cell_type(oiseau::mesh::CellKind::Pyramid));
   EXPECT_THROW(oiseau::io::detail::gmsh_celltype_to_oiseau_celltype(420), std::runtime_error);
 }
+
+TEST(test_io, gmsh_read_from_string_binary) {
+  std::string str = "$MeshFormat\n4.1 1 8\n";
+  append_binary<int>(str, 1);
+  str += "\n$EndMeshFormat\n$Nodes\n";
+  for (std::size_t v : {1, 4, 1, 4}) append_binary(str, v);
+  for (int v : {2, 1, 0}) append_binary(str, v);
+  append_binary<std::size_t>(str, 4);
+  for (std::size_t tag : {1, 2, 3, 4}) append_binary(str, tag);
+  for (double x : {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0}) {
+    append_binary(str, x);
+  }
+  str += "\n$EndNodes\n$Elements\n";
+  for (std::size_t v : {2, 3, 1, 3}) append_binary(str, v);
+  for (int v : {2, 1, 2}) append_binary(str, v);
+  append_binary<std::size_t>(str, 2);
+  for (std::size_t v : {1, 1, 2, 3, 2, 1, 3, 4}) append_binary(str, v);
+  for (int v : {2, 2, 3}) append_binary(str, v);
+  append_binary<std::size_t>(str, 1);
+  for (std::size_t v : {3, 1, 2, 3, 4}) append_binary(str, v);
+  str += "\n$EndElements\n";
+
+  oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
+  const auto& conn = mesh.topology().conn();
+  std::vector<std::vector<size_t>> actual;
+  for (auto row : conn) actual.emplace_back(row.begin(), row.end());
+  std::vector<std::vector<size_t>> expected = {{0, 1, 2}, {0, 2, 3}, {0, 1, 2, 3}};
+  EXPECT_EQ(actual, expected);
+  EXPECT_EQ(mesh.topology().cell_types()[2]->kind(), oiseau::mesh::CellKind::Quadrilateral);
+  EXPECT_EQ(mesh.geometry().x().size(), 12);
+  EXPECT_EQ(mesh.geometry().x()[6], 1.0);
+}
+
+TEST(test_io, gmsh_read_from_path_matches_file_to_mesh) {
+  const std::string str = R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$Nodes
+1 4 1 4
+2 1 0 4
+1
+2
+3
+4
+0 0 0
+1 0 0
+1 1 0
+0 1 0
+$EndNodes
+$Elements
+2 3 1 3
+2 1 2 2
+1 1 2 3
+2 1 3 4
+1 1 1 1
+3 1 2
+$EndElements
+)";
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_read_from_path.msh";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << str;
+  }
+  oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_path(path);
+  std::ifstream in(path, std::ios::binary);
+  oiseau::mesh::Mesh reference = oiseau::io::gmsh_file_to_mesh(oiseau::io::GMSHFile(in));
+  std::filesystem::remove(path);
+
+  std::vector<std::vector<size_t>> actual, expected;
+  for (auto row : mesh.topology().conn()) actual.emplace_back(row.begin(), row.end());
+  for (auto row : reference.topology().conn()) expected.emplace_back(row.begin(), row.end());
+  EXPECT_EQ(actual, (std::vector<std::vector<size_t>>{{0, 1, 2}, {0, 2, 3}}));
+  EXPECT_EQ(actual, expected);
+  const auto& facets = mesh.topology().facets();
+  ASSERT_EQ(facets.size(), 1);
+  EXPECT_EQ(std::vector<size_t>(facets.conn[0].begin(), facets.conn[0].end()),
+            (std::vector<size_t>{0, 1}));
+  EXPECT_EQ(facets.cell_types[0]->kind(), oiseau::mesh::CellKind::Interval);
+  EXPECT_EQ(reference.topology().facets().size(), 1);
+  auto x = mesh.geometry().x();
+  auto x_ref = reference.geometry().x();
+  EXPECT_EQ(std::vector<double>(x.begin(), x.end()),
+            std::vector<double>(x_ref.begin(), x_ref.end()));
+  EXPECT_THROW(oiseau::io::gmsh_read_from_path(path), std::runtime_error);
+}
+
+namespace {
+oiseau::mesh::Mesh make_mixed_mesh() {
+  using oiseau::mesh::CellKind;
+  using oiseau::mesh::get_cell_type;
+  std::vector<double> x = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0,
+                           0.0, 1.0, 0.0, 2.0, 0.5, 0.0, 0.1, 0.2, 0.3};
+  oiseau::utils::JaggedArray<std::size_t> conn = {{0, 1, 2}, {0, 2, 3}, {1, 4, 2, 5}};
+  std::vector<oiseau::mesh::CellType> cells = {get_cell_type(CellKind::Triangle),
+                                               get_cell_type(CellKind::Triangle),
+                                               get_cell_type(CellKind::Quadrilateral)};
+  oiseau::mesh::FacetTable facets{{{0, 1}, {4, 5}, {2, 3}},
+                                  {get_cell_type(CellKind::Interval),
+                                   get_cell_type(CellKind::Interval),
+                                   get_cell_type(CellKind::Interval)},
+                                  {7, 0, 7}};
+  oiseau::mesh::Topology topology(std::move(conn), std::move(cells), std::move(facets));
+  topology.set_cell_attributes({3, 3, 5}, {10, 10, 0});
+  return {std::move(topology), oiseau::mesh::Geometry(std::move(x), 3)};
+}
+
+oiseau::mesh::Mesh read_stream(const std::string& content,
+                               const oiseau::io::GMSHReadOptions& options = {}) {
+  std::istringstream in(content);
+  return oiseau::io::gmsh_read_from_stream(in, options);
+}
+
+void expect_same_mesh(const oiseau::mesh::Mesh& a, const oiseau::mesh::Mesh& b) {
+  std::vector<std::vector<size_t>> conn_a, conn_b;
+  for (auto row : a.topology().conn()) conn_a.emplace_back(row.begin(), row.end());
+  for (auto row : b.topology().conn()) conn_b.emplace_back(row.begin(), row.end());
+  EXPECT_EQ(conn_a, conn_b);
+  ASSERT_EQ(a.topology().n_cells(), b.topology().n_cells());
+  for (std::size_t i = 0; i < a.topology().n_cells(); ++i) {
+    EXPECT_EQ(a.topology().cell_types()[i], b.topology().cell_types()[i]);
+  }
+  EXPECT_TRUE(std::ranges::equal(a.topology().entity_tags(), b.topology().entity_tags()));
+  EXPECT_TRUE(std::ranges::equal(a.topology().physical_tags(), b.topology().physical_tags()));
+  const auto& facets_a = a.topology().facets();
+  const auto& facets_b = b.topology().facets();
+  ASSERT_EQ(facets_a.size(), facets_b.size());
+  for (std::size_t i = 0; i < facets_a.size(); ++i) {
+    EXPECT_EQ(std::vector<size_t>(facets_a.conn[i].begin(), facets_a.conn[i].end()),
+              std::vector<size_t>(facets_b.conn[i].begin(), facets_b.conn[i].end()));
+    EXPECT_EQ(facets_a.cell_types[i], facets_b.cell_types[i]);
+    EXPECT_EQ(facets_a.physical_tags[i], facets_b.physical_tags[i]);
+  }
+  auto x_a = a.geometry().x();
+  auto x_b = b.geometry().x();
+  EXPECT_EQ(std::vector<double>(x_a.begin(), x_a.end()),
+            std::vector<double>(x_b.begin(), x_b.end()));
+}
+}  // namespace
+
+TEST(test_io, gmsh_write_round_trip) {
+  const oiseau::mesh::Mesh mesh = make_mixed_mesh();
+  const auto dir = std::filesystem::temp_directory_path();
+  for (bool binary : {false, true}) {
+    const auto path = dir / (binary ? "oiseau_test_write_bin.msh" : "oiseau_test_write_ascii.msh");
+    oiseau::io::gmsh_write(path, mesh, {.binary = binary});
+    oiseau::mesh::Mesh read = oiseau::io::gmsh_read_from_path(path);
+    std::filesystem::remove(path);
+    expect_same_mesh(mesh, read);
+  }
+}
+
+TEST(test_io, gmsh_write_partitions) {
+  const std::vector<oiseau::mesh::Mesh> partitions(3, make_mixed_mesh());
+  const auto dir = std::filesystem::temp_directory_path();
+  std::vector<std::filesystem::path> paths;
+  for (std::size_t p = 0; p < partitions.size(); ++p) {
+    paths.push_back(dir / ("oiseau_test_partition_" + std::to_string(p) + ".msh"));
+  }
+  oiseau::io::gmsh_write_partitions(paths, partitions, {.binary = true});
+  for (const auto& path : paths) {
+    expect_same_mesh(partitions[0], oiseau::io::gmsh_read_from_path(path));
+    std::filesystem::remove(path);
+  }
+  EXPECT_THROW(oiseau::io::gmsh_write_partitions(std::span(paths).first(2), partitions),
+               std::invalid_argument);
+}
+
+TEST(test_io, gmsh_read_remaps_sparse_node_tags) {
+  for (const std::string tags : {"3 5 4 6", "7 900000000 5 123456789"}) {
+    std::istringstream in(tags);
+    std::size_t t[4];
+    for (auto& tag : t) in >> tag;
+    const std::size_t min_tag = *std::min_element(t, t + 4);
+    const std::size_t max_tag = *std::max_element(t, t + 4);
+    std::ostringstream str;
+    str << "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n$Nodes\n1 4 " << min_tag << " " << max_tag
+        << "\n2 1 0 4\n"
+        << t[0] << "\n" << t[1] << "\n" << t[2] << "\n" << t[3] << "\n"
+        << "0 0 0\n1 0 0\n1 1 0\n0 1 0\n$EndNodes\n$Elements\n1 2 1 2\n2 1 2 2\n"
+        << "1 " << t[0] << " " << t[1] << " " << t[2] << "\n"
+        << "2 " << t[0] << " " << t[2] << " " << t[3] << "\n$EndElements\n";
+    oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str.str());
+    std::vector<std::vector<size_t>> actual;
+    for (auto row : mesh.topology().conn()) actual.emplace_back(row.begin(), row.end());
+    EXPECT_EQ(actual, (std::vector<std::vector<size_t>>{{0, 1, 2}, {0, 2, 3}}));
+    expect_same_mesh(mesh, read_stream(str.str()));
+  }
+}
+
+TEST(test_io, gmsh_read_from_stream_across_splits) {
+  // A strip of triangles long enough to span several splits and batches of splits.
+  constexpr std::size_t n = 3 * oiseau::io::detail::records_per_split + 5;
+  constexpr std::size_t n_nodes = 2 * (n + 1);
+  for (bool binary : {false, true}) {
+    std::string str = binary ? "$MeshFormat\n4.1 1 8\n" : "$MeshFormat\n4.1 0 8\n";
+    if (binary) append_binary<int>(str, 1);
+    auto put = [&](auto value, char separator) {
+      if (binary) {
+        append_binary(str, value);
+      } else {
+        str += std::to_string(value);
+        str += separator;
+      }
+    };
+    str += "\n$EndMeshFormat\n$Nodes\n";
+    for (std::size_t v : {std::size_t{1}, n_nodes, std::size_t{1}}) put(v, ' ');
+    put(n_nodes, '\n');
+    for (int v : {2, 1, 0}) put(v, ' ');
+    put(n_nodes, '\n');
+    for (std::size_t tag = 1; tag <= n_nodes; ++tag) put(tag, '\n');
+    for (std::size_t i = 0; i <= n; ++i) {
+      for (double y : {0.0, 1.0}) {
+        put(static_cast<double>(i), ' ');
+        put(y, ' ');
+        put(0.0, '\n');
+      }
+    }
+    str += "$EndNodes\n$Elements\n";
+    for (std::size_t v : {std::size_t{1}, n, std::size_t{1}}) put(v, ' ');
+    put(n, '\n');
+    for (int v : {2, 1, 2}) put(v, ' ');
+    put(n, '\n');
+    for (std::size_t i = 0; i < n; ++i) {
+      put(i + 1, ' ');
+      for (std::size_t tag : {2 * i + 1, 2 * i + 3, 2 * i + 4}) put(tag, ' ');
+      if (!binary) str.back() = '\n';
+    }
+    str += "$EndElements\n";
+
+    auto mesh = oiseau::io::gmsh_read_from_string(str);
+    auto streamed = read_stream(str);
+    ASSERT_EQ(streamed.topology().n_cells(), n);
+    for (std::size_t i : {std::size_t{0}, n / 2, n - 1}) {
+      const auto row = streamed.topology().conn()[i];
+      EXPECT_EQ(std::vector<std::size_t>(row.begin(), row.end()),
+                (std::vector<std::size_t>{2 * i, 2 * i + 2, 2 * i + 3}));
+    }
+    EXPECT_TRUE(std::ranges::equal(streamed.topology().conn().data(),
+                                   mesh.topology().conn().data()));
+    EXPECT_TRUE(std::ranges::equal(streamed.geometry().x(), mesh.geometry().x()));
+  }
+
+  // MSH 2.2 blocks change physical group mid-split.
+  std::ostringstream legacy;
+  legacy << "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n$Nodes\n" << n + 1 << "\n";
+  for (std::size_t i = 0; i <= n; ++i) legacy << i + 1 << " " << i << " 0 0\n";
+  legacy << "$EndNodes\n$Elements\n" << n << "\n";
+  for (std::size_t i = 0; i < n; ++i) {
+    legacy << i + 1 << " 1 2 " << 1 + i / 10000 << " 1 " << i + 1 << " " << i + 2 << "\n";
+  }
+  legacy << "$EndElements\n";
+  const auto read = oiseau::io::gmsh_read_from_string(legacy.str());
+  EXPECT_EQ(read.topology().n_cells(), n);
+  expect_same_mesh(read, read_stream(legacy.str()));
+  expect_same_mesh(oiseau::io::gmsh_read_from_string(legacy.str(), {.physical_groups = {{1, 2}}}),
+                   read_stream(legacy.str(), {.physical_groups = {{1, 2}}}));
+}
+
+TEST(test_io, gmsh_read_second_order_triangles) {
+  const std::string str = R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$Nodes
+1 6 1 6
+2 1 0 6
+1
+2
+3
+4
+5
+6
+0 0 0
+2 0 0
+0 2 0
+1 0.1 0
+1.2 1.2 0
+0 1 0
+$EndNodes
+$Elements
+1 1 1 1
+2 1 9 1
+1 1 2 3 4 5 6
+$EndElements
+)";
+  oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
+  const auto row = mesh.topology().conn()[0];
+  EXPECT_EQ(std::vector<size_t>(row.begin(), row.end()), (std::vector<size_t>{0, 1, 2}));
+  const auto& high_order = mesh.geometry().high_order_nodes();
+  ASSERT_EQ(high_order.num_rows(), 1);
+  EXPECT_EQ(std::vector<size_t>(high_order[0].begin(), high_order[0].end()),
+            (std::vector<size_t>{3, 4, 5}));
+  EXPECT_EQ(mesh.topology().cell_types()[0]->kind(), oiseau::mesh::CellKind::Triangle);
+  const auto streamed = read_stream(str);
+  expect_same_mesh(mesh, streamed);
+  EXPECT_EQ(streamed.geometry().high_order_nodes().num_rows(), 1);
+
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_tri6.msh";
+  oiseau::io::gmsh_write(path, mesh);
+  oiseau::mesh::Mesh read = oiseau::io::gmsh_read_from_path(path);
+  std::filesystem::remove(path);
+  expect_same_mesh(mesh, read);
+  const auto& read_high_order = read.geometry().high_order_nodes();
+  ASSERT_EQ(read_high_order.num_rows(), 1);
+  EXPECT_EQ(std::vector<size_t>(read_high_order[0].begin(), read_high_order[0].end()),
+            (std::vector<size_t>{3, 4, 5}));
+}
+
+TEST(test_io, gmsh_read_legacy_ascii) {
+  const std::string str = R"($MeshFormat
+2.2 0 8
+$EndMeshFormat
+$Nodes
+4
+10 0 0 0
+20 1 0 0
+30 1 1 0
+40 0 1 0
+$EndNodes
+$Elements
+4
+1 15 2 1 1 10
+2 2 2 7 3 10 20 30
+3 2 3 7 3 0 10 30 40
+4 3 2 8 4 10 20 30 40
+$EndElements
+)";
+  oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
+  std::vector<std::vector<size_t>> actual;
+  for (auto row : mesh.topology().conn()) actual.emplace_back(row.begin(), row.end());
+  EXPECT_EQ(actual, (std::vector<std::vector<size_t>>{{0, 1, 2}, {0, 2, 3}, {0, 1, 2, 3}}));
+  EXPECT_EQ(mesh.topology().cell_types()[2]->kind(), oiseau::mesh::CellKind::Quadrilateral);
+  const auto& facets = mesh.topology().facets();
+  ASSERT_EQ(facets.size(), 1);
+  EXPECT_EQ(facets.conn[0][0], 0);
+  EXPECT_EQ(facets.physical_tags[0], 1);
+  EXPECT_TRUE(
+      std::ranges::equal(mesh.topology().entity_tags(), std::vector<std::int32_t>{3, 3, 4}));
+  EXPECT_TRUE(
+      std::ranges::equal(mesh.topology().physical_tags(), std::vector<std::int32_t>{7, 7, 8}));
+  EXPECT_EQ(mesh.geometry().x()[7], 1.0);
+
+  const oiseau::io::GMSHFile file{std::string_view(str)};
+  ASSERT_EQ(file.elements_section.blocks.size(), 3);
+  EXPECT_EQ(file.elements_section.blocks[1].entity_tag, 3);
+  EXPECT_EQ(file.elements_section.blocks[1].data, (std::vector<std::size_t>{2, 10, 20, 30, 3,
+                                                                             10, 30, 40}));
+  EXPECT_EQ(file.nodes_section.max_node_tag, 40);
+  expect_same_mesh(mesh, oiseau::io::gmsh_file_to_mesh(file));
+  expect_same_mesh(mesh, read_stream(str));
+}
+
+TEST(test_io, gmsh_read_legacy_binary) {
+  std::string str = "$MeshFormat\n2.2 1 8\n";
+  append_binary<int>(str, 1);
+  str += "\n$EndMeshFormat\n$Nodes\n4\n";
+  const double coords[4][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+  for (int i = 0; i < 4; ++i) {
+    append_binary<int>(str, i + 1);
+    for (double x : coords[i]) append_binary(str, x);
+  }
+  str += "\n$EndNodes\n$Elements\n3\n";
+  // One header for two triangles on different entities, then one quadrilateral.
+  for (int v : {2, 2, 2, 1, 7, 1, 1, 2, 3, 2, 7, 2, 1, 3, 4}) append_binary(str, v);
+  for (int v : {3, 1, 2, 3, 7, 5, 1, 2, 3, 4}) append_binary(str, v);
+  str += "\n$EndElements\n";
+
+  oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
+  std::vector<std::vector<size_t>> actual;
+  for (auto row : mesh.topology().conn()) actual.emplace_back(row.begin(), row.end());
+  EXPECT_EQ(actual, (std::vector<std::vector<size_t>>{{0, 1, 2}, {0, 2, 3}, {0, 1, 2, 3}}));
+  EXPECT_EQ(mesh.geometry().x()[6], 1.0);
+  EXPECT_EQ(mesh.geometry().x()[7], 1.0);
+
+  const oiseau::io::GMSHFile file{std::string_view(str)};
+  ASSERT_EQ(file.elements_section.blocks.size(), 3);
+  EXPECT_EQ(file.elements_section.blocks[2].entity_tag, 5);
+  EXPECT_EQ(file.elements_section.blocks[2].data, (std::vector<std::size_t>{3, 1, 2, 3, 4}));
+  expect_same_mesh(mesh, read_stream(str));
+}
+
+namespace {
+std::vector<std::vector<size_t>> connectivity(const oiseau::mesh::Mesh& mesh) {
+  std::vector<std::vector<size_t>> conn;
+  for (auto row : mesh.topology().conn()) conn.emplace_back(row.begin(), row.end());
+  return conn;
+}
+}  // namespace
+
+TEST(test_io, gmsh_read_selected_blocks) {
+  const std::string str = R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$Entities
+0 2 1 0
+1 0 0 0 1 0 0 1 20 0
+2 1 0 0 1 1 0 0 0
+1 0 0 0 1 1 0 1 10 0
+$EndEntities
+$Nodes
+2 4 1 4
+1 1 0 2
+1
+2
+0 0 0
+1 0 0
+2 1 0 2
+3
+4
+1 1 0
+0 1 0
+$EndNodes
+$Elements
+3 4 1 4
+1 1 1 1
+1 1 2
+1 2 1 1
+2 2 3
+2 1 2 2
+3 1 2 3
+4 1 3 4
+$EndElements
+)";
+  using oiseau::io::GMSHReadOptions;
+  const auto read = [&](const GMSHReadOptions& options) {
+    auto mesh = oiseau::io::gmsh_read_from_string(str, options);
+    expect_same_mesh(mesh, read_stream(str, options));
+    return mesh;
+  };
+  auto x = [](const oiseau::mesh::Mesh& mesh) {
+    return std::vector<double>(mesh.geometry().x().begin(), mesh.geometry().x().end());
+  };
+
+  const auto group = read({.physical_groups = {{1, 20}}});
+  EXPECT_EQ(connectivity(group), (std::vector<std::vector<size_t>>{{0, 1}}));
+  EXPECT_EQ(x(group), (std::vector<double>{0, 0, 0, 1, 0, 0}));
+
+  const auto curves = read({.dimensions = {1}});
+  EXPECT_EQ(connectivity(curves), (std::vector<std::vector<size_t>>{{0, 1}, {1, 2}}));
+  EXPECT_EQ(x(curves).size(), 9);
+
+  // Only the nodes of the second curve are loaded, renumbered in file order.
+  const auto entity = read({.entities = {{1, 2}}});
+  EXPECT_EQ(connectivity(entity), (std::vector<std::vector<size_t>>{{0, 1}}));
+  EXPECT_EQ(x(entity), (std::vector<double>{1, 0, 0, 1, 1, 0}));
+
+  const auto surface = read({.dimensions = {2}, .physical_groups = {{2, 10}}});
+  EXPECT_EQ(connectivity(surface), (std::vector<std::vector<size_t>>{{0, 1, 2}, {0, 2, 3}}));
+  EXPECT_EQ(x(surface), x(read({})));
+  EXPECT_EQ(surface.topology().cell_types()[0]->kind(), oiseau::mesh::CellKind::Triangle);
+  EXPECT_EQ(surface.topology().facets().size(), 0);
+
+  // Curves read alongside the surface become its facets, tagged with their physical group.
+  const auto all = read({});
+  EXPECT_EQ(connectivity(all), connectivity(surface));
+  const auto& facets = all.topology().facets();
+  ASSERT_EQ(facets.size(), 2);
+  EXPECT_EQ(std::vector<size_t>(facets.conn[1].begin(), facets.conn[1].end()),
+            (std::vector<size_t>{1, 2}));
+  EXPECT_EQ(facets.cell_types[0]->kind(), oiseau::mesh::CellKind::Interval);
+  EXPECT_EQ(facets.physical_tags, (std::vector<std::int32_t>{20, 0}));
+  EXPECT_TRUE(std::ranges::equal(all.topology().entity_tags(), std::vector<std::int32_t>{1, 1}));
+  EXPECT_TRUE(
+      std::ranges::equal(all.topology().physical_tags(), std::vector<std::int32_t>{10, 10}));
+
+  const auto none = read({.physical_groups = {{2, 20}}});
+  EXPECT_EQ(none.topology().n_cells(), 0);
+  EXPECT_TRUE(x(none).empty());
+
+  const std::string legacy = R"($MeshFormat
+2.2 0 8
+$EndMeshFormat
+$Nodes
+4
+10 0 0 0
+20 1 0 0
+30 1 1 0
+40 0 1 0
+$EndNodes
+$Elements
+3
+1 1 2 5 1 10 20
+2 2 2 7 3 10 20 30
+3 2 2 7 3 10 30 40
+$EndElements
+)";
+  const auto legacy_group =
+      oiseau::io::gmsh_read_from_string(legacy, {.physical_groups = {{1, 5}}});
+  EXPECT_EQ(connectivity(legacy_group), (std::vector<std::vector<size_t>>{{0, 1}}));
+  EXPECT_EQ(x(legacy_group).size(), 6);
+  expect_same_mesh(legacy_group, read_stream(legacy, {.physical_groups = {{1, 5}}}));
+}
+
+TEST(test_io, gmsh_read_selected_blocks_binary) {
+  const oiseau::mesh::Mesh mesh = make_mixed_mesh();
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_selected_binary.msh";
+  oiseau::io::gmsh_write(path, mesh, {.binary = true});
+  const auto lines = oiseau::io::gmsh_read_from_path(path, {.physical_groups = {{1, 7}}});
+  const auto surfaces = oiseau::io::gmsh_read_from_path(path, {.dimensions = {2}});
+  std::filesystem::remove(path);
+
+  EXPECT_EQ(connectivity(lines), (std::vector<std::vector<size_t>>{{0, 1}, {2, 3}}));
+  const auto x = mesh.geometry().x();
+  EXPECT_EQ(std::vector<double>(lines.geometry().x().begin(), lines.geometry().x().end()),
+            std::vector<double>(x.begin(), x.begin() + 12));
+  EXPECT_EQ(connectivity(surfaces),
+            (std::vector<std::vector<size_t>>{{0, 1, 2}, {0, 2, 3}, {1, 4, 2, 5}}));
+  EXPECT_EQ(surfaces.geometry().x().size(), x.size());
+}
+
+TEST(test_io, gmsh_read_partition) {
+  // Two triangles and a bottom line per partition; every partition sees one ghost triangle.
+  const std::string str = R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$PartitionedEntities
+2
+0
+0 2 2 0
+1 1 1 1 1 0 0 0 1 0 0 1 7 0
+2 1 1 1 2 1 0 0 2 0 0 1 7 0
+3 2 1 1 1 0 0 0 1 1 0 0 0
+4 2 1 1 2 1 0 0 2 1 0 0 0
+$EndPartitionedEntities
+$Nodes
+2 6 1 6
+2 3 0 4
+1
+2
+4
+5
+0 0 0
+1 0 0
+0 1 0
+1 1 0
+2 4 0 2
+3
+6
+2 0 0
+2 1 0
+$EndNodes
+$Elements
+4 6 1 6
+1 1 1 1
+5 1 2
+1 2 1 1
+6 2 3
+2 3 2 2
+1 1 2 5
+2 1 5 4
+2 4 2 2
+3 2 3 6
+4 2 6 5
+$EndElements
+$GhostElements
+2
+2 1 1 2
+4 2 1 1
+$EndGhostElements
+)";
+  const oiseau::io::GMSHFile file{std::string_view(str)};
+  const auto& partitioned = file.partitioned_entities_section;
+  EXPECT_EQ(partitioned.num_partitions, 2);
+  ASSERT_EQ(partitioned.blocks[1].size(), 2);
+  EXPECT_EQ(partitioned.blocks[1][1].partitions, (std::vector<int>{2}));
+  EXPECT_EQ(partitioned.blocks[1][1].physical_tags, (std::vector<int>{7}));
+  EXPECT_EQ(partitioned.blocks[2][0].parent_tag, 1);
+  ASSERT_EQ(file.ghost_elements_section.elements.size(), 2);
+  EXPECT_EQ(file.ghost_elements_section.elements[1].element_tag, 4);
+  EXPECT_EQ(file.ghost_elements_section.elements[1].owner, 2);
+
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_partitioned.msh";
+  std::ofstream(path) << str;
+  const auto first = oiseau::io::gmsh_read_partition(path, 1);
+  const auto second = oiseau::io::gmsh_read_partition(path, 2);
+  EXPECT_THROW(oiseau::io::gmsh_read_partition(path, 3), std::invalid_argument);
+  EXPECT_EQ(oiseau::io::gmsh_read_from_path(path).topology().n_cells(), 4);
+  std::filesystem::remove(path);
+
+  // Only the nodes of the partition and of its ghosts are loaded, renumbered in file order.
+  EXPECT_EQ(first.num_owned_cells, 2);
+  EXPECT_EQ(first.ghost_owners, (std::vector<int>{2}));
+  EXPECT_EQ(connectivity(first.mesh),
+            (std::vector<std::vector<size_t>>{{0, 1, 3}, {0, 3, 2}, {1, 4, 3}}));
+  EXPECT_EQ(std::vector<double>(first.mesh.geometry().x().begin(),
+                                first.mesh.geometry().x().end()),
+            (std::vector<double>{0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0, 2, 1, 0}));
+  const auto& facets = first.mesh.topology().facets();
+  ASSERT_EQ(facets.size(), 1);
+  EXPECT_EQ(std::vector<size_t>(facets.conn[0].begin(), facets.conn[0].end()),
+            (std::vector<size_t>{0, 1}));
+  EXPECT_EQ(facets.physical_tags[0], 7);
+
+  EXPECT_EQ(second.num_owned_cells, 2);
+  EXPECT_EQ(second.ghost_owners, (std::vector<int>{1}));
+  EXPECT_EQ(connectivity(second.mesh),
+            (std::vector<std::vector<size_t>>{{1, 4, 5}, {1, 5, 3}, {0, 3, 2}}));
+  EXPECT_EQ(second.mesh.geometry().x().size(), 18);
+
+  const std::string plain = "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n";
+  EXPECT_THROW(oiseau::io::detail::gmsh_content_to_partition(
+                   plain, oiseau::io::detail::index_file(plain), 1),
+               std::runtime_error);
+}
+
+#ifdef OISEAU_HAS_ZLIB
+namespace {
+/// Gzips `content` into `path` as two concatenated members, the way parallel gzip tools do.
+void write_gzip(const std::filesystem::path& path, const std::string& content) {
+  const std::size_t half = content.size() / 2;
+  for (const auto [mode, begin, end] :
+       {std::tuple{"wb", std::size_t{0}, half}, std::tuple{"ab", half, content.size()}}) {
+    gzFile out = gzopen(path.c_str(), mode);
+    ASSERT_NE(out, nullptr);
+    gzwrite(out, content.data() + begin, static_cast<unsigned>(end - begin));
+    gzclose(out);
+  }
+}
+}  // namespace
+
+TEST(test_io, gmsh_read_gzip) {
+  const oiseau::mesh::Mesh mesh = make_mixed_mesh();
+  const auto dir = std::filesystem::temp_directory_path();
+  const auto plain = dir / "oiseau_test_gzip.msh";
+  const auto compressed = dir / "oiseau_test_gzip.msh.gz";
+  oiseau::io::gmsh_write(plain, mesh, {.binary = true});
+  std::string content;
+  {
+    std::ifstream in(plain, std::ios::binary);
+    content = oiseau::io::detail::read_all(in);
+  }
+  write_gzip(compressed, content);
+  oiseau::mesh::Mesh read = oiseau::io::gmsh_read_from_path(compressed);
+  expect_same_mesh(mesh, read);
+
+  // A ring of two tiny chunks makes the producer wrap around and wait on the reader.
+  {
+    using oiseau::io::detail::Compression;
+    oiseau::io::detail::MappedFile file(compressed);
+    ASSERT_EQ(oiseau::io::detail::detect_compression(file.view()), Compression::Gzip);
+    oiseau::io::detail::DecompressingStreambuf buffer(std::move(file), Compression::Gzip, 7, 2);
+    std::istream stream(&buffer);
+    EXPECT_EQ(oiseau::io::detail::read_all(stream), content);
+  }
+
+  // A truncated file surfaces as an error rather than as a silently shorter mesh.
+  const auto size = std::filesystem::file_size(compressed);
+  std::filesystem::resize_file(compressed, size - 16);
+  EXPECT_THROW(oiseau::io::gmsh_read_from_path(compressed), std::runtime_error);
+  std::filesystem::remove(plain);
+  std::filesystem::remove(compressed);
+}
+#endif
@@ -6,10 +6,17 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "oiseau/io/gmsh_file.hpp"
+#include "oiseau/io/gmsh_index.hpp"
+#include "oiseau/test_utils.hpp"
+
+using oiseau::test::append_binary;
 
 TEST(test_io, gmsh_parser_mesh_format_handler) {
   std::string str =
@@ -75,3 +82,129 @@ TEST(test_io, gmsh_parser_nodes_handler) {
   EXPECT_EQ(s.blocks[0].node_coords[1], -1);
   EXPECT_EQ(s.blocks[0].node_coords[2], 0);
 }
+
+TEST(test_io, gmsh_index_file_locates_blocks) {
+  std::string str =
+      R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$Nodes
+2 3 1 3
+0 1 0 1
+1
+0 0 0
+2 1 0 2
+2
+3
+1 0 0
+0 1 0
+$EndNodes
+$Elements
+1 1 1 1
+2 1 2 1
+1 1 2 3
+$EndElements
+)";
+  auto index = oiseau::io::detail::index_file(str);
+  ASSERT_EQ(index.sections.size(), 3);
+  EXPECT_EQ(index.sections[0].name, "MeshFormat");
+  EXPECT_EQ(index.format.version, 4.1);
+
+  const auto* nodes = index.find("Nodes");
+  ASSERT_NE(nodes, nullptr);
+  EXPECT_EQ(nodes->header[1], 3);
+  ASSERT_EQ(nodes->blocks.size(), 2);
+  EXPECT_EQ(nodes->blocks[1].entity_dim, 2);
+  EXPECT_EQ(nodes->blocks[1].count, 2);
+  EXPECT_EQ(nodes->blocks[1].first, 1);
+  EXPECT_EQ(str.substr(nodes->blocks[1].coords.begin, 5), "1 0 0");
+  EXPECT_EQ(nodes->body(str).find("$EndNodes"), std::string::npos);
+
+  const auto* elements = index.find("Elements");
+  ASSERT_NE(elements, nullptr);
+  EXPECT_EQ(elements->blocks[0].type, 2);
+  EXPECT_EQ(str.substr(elements->blocks[0].records.begin, 7), "1 1 2 3");
+  EXPECT_EQ(index.find("PhysicalNames"), nullptr);
+}
+
+TEST(test_io, gmsh_file_binary_sections) {
+  std::string str = "$MeshFormat\n4.1 1 8\n";
+  append_binary<int>(str, 1);
+  str += "\n$EndMeshFormat\n$Nodes\n";
+  for (std::size_t v : {1, 3, 1, 3}) append_binary(str, v);
+  for (int v : {2, 1, 0}) append_binary(str, v);
+  append_binary<std::size_t>(str, 3);
+  for (std::size_t tag : {1, 2, 3}) append_binary(str, tag);
+  for (double x : {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0}) append_binary(str, x);
+  str += "\n$EndNodes\n$Elements\n";
+  for (std::size_t v : {1, 1, 1, 1}) append_binary(str, v);
+  for (int v : {2, 1, 2}) append_binary(str, v);
+  append_binary<std::size_t>(str, 1);
+  for (std::size_t v : {1, 1, 2, 3}) append_binary(str, v);
+  str += "\n$EndElements\n";
+
+  oiseau::io::GMSHFile file(str);
+  EXPECT_EQ(file.mesh_format_section.is_binary, 1);
+  ASSERT_EQ(file.nodes_section.blocks.size(), 1);
+  EXPECT_EQ(file.nodes_section.blocks[0].node_tags, (std::vector<std::size_t>{1, 2, 3}));
+  EXPECT_EQ(file.nodes_section.blocks[0].node_coords[3], 1.0);
+  EXPECT_EQ(file.nodes_section.blocks[0].node_coords[7], 1.0);
+  ASSERT_EQ(file.elements_section.blocks.size(), 1);
+  EXPECT_EQ(file.elements_section.blocks[0].data, (std::vector<std::size_t>{1, 1, 2, 3}));
+}
+
+TEST(test_io, gmsh_file_splits_large_blocks) {
+  const std::size_t n = 3 * oiseau::io::detail::records_per_split + 7;
+  std::ostringstream out;
+  out << "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n$Nodes\n1 " << n << " 1 " << n << "\n";
+  out << "1 1 0 " << n << "\n";
+  for (std::size_t i = 1; i <= n; ++i) out << i << "\n";
+  for (std::size_t i = 0; i < n; ++i) out << i << " " << 0.5 * i << " 0\n";
+  out << "$EndNodes\n$Elements\n1 " << n - 1 << " 1 " << n - 1 << "\n";
+  out << "1 1 1 " << n - 1 << "\n";
+  for (std::size_t i = 1; i < n; ++i) out << i << " " << i << " " << i + 1 << "\n";
+  out << "$EndElements\n";
+
+  std::istringstream stream(out.str());
+  oiseau::io::GMSHFile file(stream);
+  const auto& nodes = file.nodes_section.blocks[0];
+  ASSERT_EQ(nodes.node_tags.size(), n);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(nodes.node_tags[i], i + 1);
+    ASSERT_EQ(nodes.node_coords[3 * i], static_cast<double>(i));
+    ASSERT_EQ(nodes.node_coords[3 * i + 1], 0.5 * i);
+  }
+  const auto& elements = file.elements_section.blocks[0];
+  ASSERT_EQ(elements.data.size(), 3 * (n - 1));
+  for (std::size_t i = 0; i + 1 < n; ++i) {
+    ASSERT_EQ(elements.data[3 * i], i + 1);
+    ASSERT_EQ(elements.data[3 * i + 2], i + 2);
+  }
+}
+
+TEST(test_io, gmsh_node_tag_map) {
+  const std::vector<std::size_t> contiguous = {1, 2, 3, 4};
+  EXPECT_TRUE(oiseau::io::detail::NodeTagMap(contiguous, 1, 4).is_identity());
+
+  const std::vector<std::size_t> gaps = {11, 14, 12, 15};
+  oiseau::io::detail::NodeTagMap dense(gaps, 11, 15);
+  EXPECT_TRUE(dense.is_dense());
+  std::vector<std::size_t> conn = {10, 13, 11, 14};
+  dense.remap(conn);
+  EXPECT_EQ(conn, (std::vector<std::size_t>{0, 1, 2, 3}));
+  EXPECT_THROW(dense(13), std::runtime_error);
+
+  const std::vector<std::size_t> scattered = {5, 1000000, 42};
+  oiseau::io::detail::NodeTagMap sparse(scattered, 5, 1000000);
+  EXPECT_FALSE(sparse.is_identity());
+  EXPECT_FALSE(sparse.is_dense());
+  EXPECT_EQ(sparse(1000000), 1);
+  EXPECT_EQ(sparse(42), 2);
+  EXPECT_THROW(sparse(6), std::runtime_error);
+
+  // A tag listed twice is rejected rather than silently mapped to its last node.
+  const std::vector<std::size_t> dense_duplicate = {11, 14, 12, 14};
+  EXPECT_THROW(oiseau::io::detail::NodeTagMap(dense_duplicate, 11, 14), std::runtime_error);
+  const std::vector<std::size_t> sparse_duplicate = {5, 1000000, 5};
+  EXPECT_THROW(oiseau::io::detail::NodeTagMap(sparse_duplicate, 5, 1000000), std::runtime_error);
+}
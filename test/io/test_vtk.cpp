@@ -0,0 +1,185 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/io/vtk.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
+TEST(test_io, vtk_lagrange_nodes_cover_the_lattice) {
+  using oiseau::mesh::CellKind;
+  for (CellKind kind : {CellKind::Interval, CellKind::Triangle, CellKind::Quadrilateral,
+                        CellKind::Tetrahedron, CellKind::Hexahedron, CellKind::Prism}) {
+    const std::size_t dim = oiseau::mesh::get_cell_type(kind)->dimension();
+    const std::vector<double> vertices = oiseau::mesh::reference_nodes(kind, 1);
+    for (unsigned order = 1; order <= 6; ++order) {
+      const std::vector<double> nodes = oiseau::io::detail::vtk_lagrange_nodes(kind, order);
+      ASSERT_EQ(nodes.size(), dim * oiseau::mesh::number_of_nodes(kind, order));
+      EXPECT_EQ(std::vector<double>(nodes.begin(), nodes.begin() + vertices.size()), vertices);
+      std::set<std::vector<double>> unique;
+      for (std::size_t p = 0; p < nodes.size(); p += dim) {
+        unique.emplace(nodes.begin() + p, nodes.begin() + p + dim);
+      }
+      EXPECT_EQ(unique.size() * dim, nodes.size());
+    }
+  }
+}
+
+TEST(test_io, vtk_lagrange_nodes_follow_vtk_ordering) {
+  using oiseau::mesh::CellKind;
+  using oiseau::io::detail::vtk_lagrange_nodes;
+  EXPECT_EQ(vtk_lagrange_nodes(CellKind::Quadrilateral, 2),
+            (std::vector<double>{-1, -1, 1, -1, 1, 1, -1, 1, 0, -1, 1, 0, 0, 1, -1, 0, 0, 0}));
+
+  // The triangle interior comes last; edges run 0-1, 1-2, 2-0.
+  const auto tri = vtk_lagrange_nodes(CellKind::Triangle, 3);
+  EXPECT_DOUBLE_EQ(tri[2 * 5], 1.0 / 3.0);  // second point of edge 1-2
+  EXPECT_DOUBLE_EQ(tri[2 * 5 + 1], -1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(tri[2 * 9], -1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(tri[2 * 9 + 1], -1.0 / 3.0);
+
+  // VTU 2.2 numbers the vertical hexahedron edges like the linear cell: 0-4, 1-5, 2-6, 3-7.
+  const auto hex = vtk_lagrange_nodes(CellKind::Hexahedron, 2);
+  EXPECT_EQ(std::vector<double>(hex.begin() + 3 * 16, hex.begin() + 3 * 20),
+            (std::vector<double>{-1, -1, 0, 1, -1, 0, 1, 1, 0, -1, 1, 0}));
+  EXPECT_EQ(std::vector<double>(hex.begin() + 3 * 20, hex.begin() + 3 * 22),
+            (std::vector<double>{-1, 0, 0, 1, 0, 0}));
+
+  // Faces of the tetrahedron are (0,1,3), (2,3,1), (0,3,2), (0,2,1).
+  const auto tet = vtk_lagrange_nodes(CellKind::Tetrahedron, 4);
+  const std::size_t face0 = 4 + 6 * 3;
+  EXPECT_EQ(std::vector<double>(tet.begin() + 3 * face0, tet.begin() + 3 * (face0 + 3)),
+            (std::vector<double>{-0.5, -1, -0.5, 0, -1, -0.5, -0.5, -1, 0}));
+  EXPECT_EQ(std::vector<double>(tet.end() - 3, tet.end()), (std::vector<double>{-0.5, -0.5, -0.5}));
+
+  EXPECT_THROW(vtk_lagrange_nodes(CellKind::Pyramid, 2), std::runtime_error);
+}
+
+TEST(test_io, vtu_write_raw_appended) {
+  const std::vector<double> points = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+  const std::vector<std::int64_t> connectivity = {0, 1, 2};
+  const std::vector<std::int64_t> offsets = {3};
+  const std::vector<std::uint8_t> types = {
+      oiseau::io::detail::vtk_lagrange_cell_type(oiseau::mesh::CellKind::Triangle)};
+  const std::vector<double> u = {1.5, 2.5, 3.5};
+  const std::vector<oiseau::io::VTUField> fields = {{"u<1>", u}};
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_write.vtu";
+  oiseau::io::detail::write_vtu(path, {points, connectivity, offsets, types, fields});
+
+  std::ifstream in(path, std::ios::binary);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string content = buffer.str();
+  std::filesystem::remove(path);
+
+  EXPECT_NE(content.find("NumberOfPoints=\"3\" NumberOfCells=\"1\""), std::string::npos);
+  EXPECT_NE(content.find("Name=\"u&lt;1&gt;\""), std::string::npos);
+  EXPECT_NE(content.find("Name=\"types\" format=\"appended\" offset=\"160\""), std::string::npos);
+  const std::size_t data = content.find("encoding=\"raw\">\n_") + 17;
+  std::uint64_t bytes = 0;
+  std::memcpy(&bytes, content.data() + data, sizeof(bytes));
+  ASSERT_EQ(bytes, sizeof(double) * u.size());
+  std::vector<double> read(u.size());
+  std::memcpy(read.data(), content.data() + data + sizeof(bytes), bytes);
+  EXPECT_EQ(read, u);
+  EXPECT_EQ(static_cast<std::uint8_t>(content[data + 160 + sizeof(bytes)]), 69);
+
+  const std::vector<double> short_field = {1.0};
+  const std::vector<oiseau::io::VTUField> bad = {{"v", short_field}};
+  EXPECT_THROW(oiseau::io::detail::write_vtu(path, {points, connectivity, offsets, types, bad}),
+               std::invalid_argument);
+}
+
+namespace {
+/// Reads the appended array whose `DataArray` tag ends with `attributes`.
+template <class T>
+std::vector<T> appended_array(const std::string& content, const std::string& attributes) {
+  const std::string key = attributes + " format=\"appended\" offset=\"";
+  const std::size_t tag = content.find(key);
+  if (tag == std::string::npos) return {};
+  const std::size_t offset = std::stoull(content.substr(tag + key.size()));
+  const std::size_t data = content.find("encoding=\"raw\">\n_") + 17 + offset;
+  std::uint64_t bytes = 0;
+  std::memcpy(&bytes, content.data() + data, sizeof(bytes));
+  std::vector<T> values(bytes / sizeof(T));
+  std::memcpy(values.data(), content.data() + data + sizeof(bytes), bytes);
+  return values;
+}
+}  // namespace
+
+TEST(test_io, vtu_write_dg_space) {
+  using oiseau::mesh::CellKind;
+  const auto triangle = oiseau::mesh::get_cell_type(CellKind::Triangle);
+  oiseau::mesh::Topology topology(oiseau::utils::JaggedArray<std::size_t>{{0, 1, 2}, {1, 3, 2}},
+                                  {triangle, triangle});
+  const oiseau::mesh::Mesh mesh(std::move(topology),
+                                oiseau::mesh::Geometry({0, 0, 1, 0, 0, 1, 1, 1.5}, 2));
+  const oiseau::dg::DGSpace space(mesh, {2, 2});
+
+  // A linear field is reproduced exactly at the Lagrange points.
+  auto linear = [](double x, double y) { return 2.0 * x - 3.0 * y + 1.0; };
+  std::vector<double> u;
+  for (const auto& element : space.elements()) {
+    const auto& nodes = element.nodes();
+    for (std::size_t i = 0; i < element.reference().number_of_nodes(); ++i) {
+      u.push_back(linear(nodes(i, 0), nodes(i, 1)));
+    }
+  }
+  const std::vector<oiseau::io::VTUField> fields = {{"u", u}};
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_dg_space.vtu";
+  oiseau::io::vtu_write(path, space, fields);
+  std::ifstream in(path, std::ios::binary);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string content = buffer.str();
+  std::filesystem::remove(path);
+
+  EXPECT_NE(content.find("NumberOfPoints=\"12\" NumberOfCells=\"2\""), std::string::npos);
+  const auto points = appended_array<double>(content, "NumberOfComponents=\"3\"");
+  const auto values = appended_array<double>(content, "Name=\"u\" NumberOfComponents=\"1\"");
+  const auto offsets = appended_array<std::int64_t>(content, "Name=\"offsets\"");
+  ASSERT_EQ(points.size(), 3 * 12);
+  ASSERT_EQ(values.size(), 12);
+  EXPECT_EQ(offsets, (std::vector<std::int64_t>{6, 12}));
+  for (std::size_t p = 0; p < 12; ++p) {
+    EXPECT_NEAR(values[p], linear(points[3 * p], points[3 * p + 1]), 1e-12);
+    EXPECT_EQ(points[3 * p + 2], 0.0);
+  }
+
+  // The first points of every cell are its vertices, matching the corner nodes of the element.
+  const std::vector<std::pair<double, double>> corners = {{-1, -1}, {1, -1}, {-1, 1}};
+  for (std::size_t e = 0; e < 2; ++e) {
+    const auto& element = space.elements()[e];
+    const auto& r = element.reference().r();
+    for (std::size_t v = 0; v < corners.size(); ++v) {
+      std::size_t node = 0;
+      while (std::abs(r(node, 0) - corners[v].first) + std::abs(r(node, 1) - corners[v].second) >
+             1e-12) {
+        ++node;
+      }
+      const double* point = points.data() + 3 * (6 * e + v);
+      EXPECT_NEAR(point[0], element.nodes()(node, 0), 1e-12);
+      EXPECT_NEAR(point[1], element.nodes()(node, 1), 1e-12);
+    }
+  }
+}
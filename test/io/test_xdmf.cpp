@@ -0,0 +1,114 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "oiseau/io/xdmf.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/mesh.hpp"
+
+namespace {
+std::string read_file(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  return buffer.str();
+}
+
+oiseau::mesh::Mesh make_square(bool mixed) {
+  using oiseau::mesh::CellKind;
+  using oiseau::mesh::get_cell_type;
+  std::vector<double> x = {0, 0, 1, 0, 1, 1, 0, 1};
+  std::vector<std::vector<std::size_t>> conn = {{0, 1, 2}, {0, 2, 3}};
+  std::vector<oiseau::mesh::CellType> cells(2, get_cell_type(CellKind::Triangle));
+  if (mixed) {
+    conn.push_back({0, 1});
+    cells.push_back(get_cell_type(CellKind::Interval));
+  }
+  return {oiseau::mesh::Topology(std::move(conn), std::move(cells)),
+          oiseau::mesh::Geometry(std::move(x), 2)};
+}
+}  // namespace
+
+TEST(test_io, xdmf_time_series_shares_the_mesh) {
+  const auto dir = std::filesystem::temp_directory_path();
+  const auto path = dir / "oiseau_test_series.xdmf";
+  const auto bin = dir / "oiseau_test_series.bin";
+  const oiseau::mesh::Mesh mesh = make_square(false);
+  const std::size_t mesh_bytes = 8 * sizeof(double) + 6 * sizeof(std::int64_t);
+  {
+    oiseau::io::XDMFWriter writer(path, mesh);
+    EXPECT_EQ(read_file(path).find("<Grid Name=\"step_"), std::string::npos);
+    for (int step = 0; step < 3; ++step) {
+      const std::vector<double> u(4, step + 0.5);
+      const std::vector<double> e(2 * 3, -step);
+      const std::vector<oiseau::io::XDMFField> fields = {
+          {"u", u}, {"E", e, 3, oiseau::io::XDMFCenter::Cell}};
+      writer.write(0.25 * step, fields);
+    }
+    EXPECT_EQ(writer.num_steps(), 3);
+    const std::vector<double> wrong(3);
+    const std::vector<oiseau::io::XDMFField> bad = {{"u", wrong}};
+    EXPECT_THROW(writer.write(1.0, bad), std::invalid_argument);
+  }
+
+  const std::string index = read_file(path);
+  const std::string data = read_file(bin);
+  std::filesystem::remove(path);
+  std::filesystem::remove(bin);
+
+  EXPECT_EQ(data.size(), mesh_bytes + 3 * (4 + 6) * sizeof(double));
+  EXPECT_TRUE(index.ends_with("    </Grid>\n  </Domain>\n</Xdmf>\n"));
+  EXPECT_NE(index.find("<Time Value=\"0.5\"/>"), std::string::npos);
+  EXPECT_NE(index.find("TopologyType=\"Triangle\" NumberOfElements=\"2\" NodesPerElement=\"3\""),
+            std::string::npos);
+  // Every step refers to the single copy of the mesh at the start of the binary file.
+  std::size_t count = 0;
+  for (auto pos = index.find("Seek=\"0\""); pos != std::string::npos;
+       pos = index.find("Seek=\"0\"", pos + 1)) {
+    ++count;
+  }
+  EXPECT_EQ(count, 3);
+
+  const std::size_t step2 = mesh_bytes + 2 * (4 + 6) * sizeof(double);
+  EXPECT_NE(index.find("Seek=\"" + std::to_string(step2) + "\" Dimensions=\"4 1\""),
+            std::string::npos);
+  double value = 0;
+  std::memcpy(&value, data.data() + step2, sizeof(double));
+  EXPECT_EQ(value, 2.5);
+  std::int64_t node = 0;
+  std::memcpy(&node, data.data() + 8 * sizeof(double) + 5 * sizeof(std::int64_t), sizeof(node));
+  EXPECT_EQ(node, 3);
+}
+
+TEST(test_io, xdmf_mixed_topology) {
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_mixed.xdmf";
+  const auto bin = std::filesystem::temp_directory_path() / "oiseau_test_mixed.bin";
+  {
+    oiseau::io::XDMFWriter writer(path, make_square(true));
+    writer.write(0.0, {});
+  }
+  const std::string index = read_file(path);
+  const std::string data = read_file(bin);
+  std::filesystem::remove(path);
+  std::filesystem::remove(bin);
+  EXPECT_NE(index.find("TopologyType=\"Mixed\" NumberOfElements=\"3\""), std::string::npos);
+  // Two triangles (type, 3 nodes) and a polyline (type, count, 2 nodes).
+  ASSERT_EQ(data.size(), 8 * sizeof(double) + 12 * sizeof(std::int64_t));
+  std::vector<std::int64_t> cells(12);
+  std::memcpy(cells.data(), data.data() + 8 * sizeof(double), 12 * sizeof(std::int64_t));
+  EXPECT_EQ(cells, (std::vector<std::int64_t>{4, 0, 1, 2, 4, 0, 2, 3, 2, 2, 0, 1}));
+}
@@ -6,6 +6,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "oiseau/mesh/cell.hpp"
 
 TEST(test_mesh, triangle_cell) {
@@ -17,3 +19,24 @@ TEST(test_mesh, triangle_cell) {
   EXPECT_EQ(tricell.dimension(), 2);
   auto cell = TriangleCell();
 }
+
+TEST(test_mesh, prism_and_pyramid_cells) {
+  using namespace oiseau::mesh;
+  auto prism = PrismCell();
+  EXPECT_STREQ(prism.name().data(), "prism");
+  EXPECT_EQ(prism.dimension(), 3);
+  EXPECT_EQ(prism.num_sub_entities(0), 6);
+  EXPECT_EQ(prism.num_sub_entities(1), 9);
+  EXPECT_EQ(prism.num_sub_entities(2), 5);
+  EXPECT_EQ(prism.get_entity_vertices(2)[2], (std::vector<int>{0, 1, 4, 3}));
+  EXPECT_EQ(prism.facet(), nullptr);
+  EXPECT_STREQ(prism.edge()->name().data(), "interval");
+
+  auto pyramid = PyramidCell();
+  EXPECT_STREQ(pyramid.name().data(), "pyramid");
+  EXPECT_EQ(get_cell_type(CellKind::Pyramid)->kind(), CellKind::Pyramid);
+  EXPECT_EQ(pyramid.num_sub_entities(0), 5);
+  EXPECT_EQ(pyramid.num_sub_entities(1), 8);
+  EXPECT_EQ(pyramid.num_sub_entities(2), 5);
+  EXPECT_EQ(pyramid.get_sub_entities(0, 4)[2], (std::vector<int>{1, 2, 3, 4}));
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+
+TEST(test_mesh, geometry_order) {
+  using oiseau::mesh::CellKind;
+  EXPECT_EQ(oiseau::mesh::geometry_order(CellKind::Triangle, 3), 1);
+  EXPECT_EQ(oiseau::mesh::geometry_order(CellKind::Triangle, 6), 2);
+  EXPECT_EQ(oiseau::mesh::geometry_order(CellKind::Quadrilateral, 9), 2);
+  EXPECT_EQ(oiseau::mesh::geometry_order(CellKind::Tetrahedron, 10), 2);
+  EXPECT_EQ(oiseau::mesh::geometry_order(CellKind::Hexahedron, 27), 2);
+  EXPECT_EQ(oiseau::mesh::geometry_order(CellKind::Prism, 18), 2);
+  EXPECT_EQ(oiseau::mesh::geometry_order(CellKind::Pyramid, 14), 2);
+  EXPECT_THROW(oiseau::mesh::geometry_order(CellKind::Triangle, 7), std::runtime_error);
+}
+
+TEST(test_mesh, reference_nodes_follow_gmsh_ordering) {
+  using oiseau::mesh::CellKind;
+  EXPECT_EQ(oiseau::mesh::reference_nodes(CellKind::Triangle, 2),
+            (std::vector<double>{-1, -1, 1, -1, -1, 1, 0, -1, 0, 0, -1, 0}));
+  EXPECT_EQ(oiseau::mesh::reference_nodes(CellKind::Quadrilateral, 2),
+            (std::vector<double>{-1, -1, 1, -1, 1, 1, -1, 1, 0, -1, 1, 0, 0, 1, -1, 0, 0, 0}));
+  const auto line4 = oiseau::mesh::reference_nodes(CellKind::Interval, 3);
+  ASSERT_EQ(line4.size(), 4);
+  EXPECT_DOUBLE_EQ(line4[1], 1.0);
+  EXPECT_DOUBLE_EQ(line4[2], -1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(line4[3], 1.0 / 3.0);
+
+  const auto tri4 = oiseau::mesh::reference_nodes(CellKind::Triangle, 4);
+  ASSERT_EQ(tri4.size(), 2 * 15);
+  EXPECT_DOUBLE_EQ(tri4[2 * 12], -0.5);  // first interior node
+  EXPECT_DOUBLE_EQ(tri4[2 * 12 + 1], -0.5);
+
+  const auto hex27 = oiseau::mesh::reference_nodes(CellKind::Hexahedron, 2);
+  ASSERT_EQ(hex27.size(), 3 * 27);
+  EXPECT_EQ(std::vector<double>(hex27.end() - 3, hex27.end()), (std::vector<double>{0, 0, 0}));
+  EXPECT_EQ(oiseau::mesh::reference_nodes(CellKind::Tetrahedron, 1).size(), 3 * 4);
+  EXPECT_THROW(oiseau::mesh::reference_nodes(CellKind::Tetrahedron, 3), std::runtime_error);
+  EXPECT_EQ(oiseau::mesh::reference_nodes(CellKind::Prism, 1).size(), 3 * 6);
+  const auto pyramid5 = oiseau::mesh::reference_nodes(CellKind::Pyramid, 1);
+  EXPECT_EQ(std::vector<double>(pyramid5.end() - 3, pyramid5.end()),
+            (std::vector<double>{0, 0, 1}));
+}
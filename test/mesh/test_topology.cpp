@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/jagged_array.hpp"
+
+TEST(test_mesh, sort_cells_by_attribute) {
+  using oiseau::mesh::CellKind;
+  using oiseau::mesh::get_cell_type;
+  oiseau::utils::JaggedArray<std::size_t> conn = {{0, 1, 2}, {1, 3, 4, 2}, {2, 4, 5}, {3, 6, 4}};
+  std::vector<oiseau::mesh::CellType> cells = {
+      get_cell_type(CellKind::Triangle), get_cell_type(CellKind::Quadrilateral),
+      get_cell_type(CellKind::Triangle), get_cell_type(CellKind::Triangle)};
+  oiseau::mesh::Topology topology(std::move(conn), std::move(cells));
+  EXPECT_THROW(topology.set_cell_attributes({1, 2}, {}), std::invalid_argument);
+  topology.set_cell_attributes({4, 3, 4, 1}, {20, 10, 20, 10});
+  oiseau::utils::JaggedArray<std::size_t> high_order = {{10}, {11, 12}, {13}, {14}};
+  oiseau::mesh::Mesh mesh(std::move(topology),
+                          oiseau::mesh::Geometry(std::vector<double>(21, 0.0), 3,
+                                                 std::move(high_order)));
+
+  const auto sorted = oiseau::mesh::sort_cells_by(mesh, oiseau::mesh::CellAttribute::PhysicalTag);
+  EXPECT_EQ(sorted.order, (std::vector<std::size_t>{1, 3, 0, 2}));
+  ASSERT_EQ(sorted.ranges.size(), 2);
+  EXPECT_EQ(sorted.ranges[0].value, 10);
+  EXPECT_EQ(sorted.ranges[0].end, 2);
+  EXPECT_EQ(sorted.ranges[1].begin, 2);
+  EXPECT_EQ(sorted.ranges[1].end, 4);
+
+  const auto& sorted_topology = mesh.topology();
+  EXPECT_EQ(sorted_topology.cell_types()[0]->kind(), CellKind::Quadrilateral);
+  EXPECT_EQ(std::vector<std::size_t>(sorted_topology.conn()[1].begin(),
+                                     sorted_topology.conn()[1].end()),
+            (std::vector<std::size_t>{3, 6, 4}));
+  EXPECT_EQ(std::vector<std::int32_t>(sorted_topology.entity_tags().begin(),
+                                      sorted_topology.entity_tags().end()),
+            (std::vector<std::int32_t>{3, 1, 4, 4}));
+  const auto& nodes = mesh.geometry().high_order_nodes();
+  EXPECT_EQ(std::vector<std::size_t>(nodes[0].begin(), nodes[0].end()),
+            (std::vector<std::size_t>{11, 12}));
+  EXPECT_EQ(nodes[3][0], 13);
+
+  EXPECT_EQ(oiseau::mesh::attribute_ranges(sorted_topology.entity_tags()).size(), 3);
+  oiseau::mesh::Mesh bare;
+  EXPECT_NO_THROW(oiseau::mesh::sort_cells_by(bare, oiseau::mesh::CellAttribute::EntityTag));
+}
@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <string>
+
+namespace oiseau::test {
+
+/// Appends the native bytes of `value` to `s`, as they appear in binary MSH files.
+template <class T>
+void append_binary(std::string& s, T value) {
+  s.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+}  // namespace oiseau::test
@@ -0,0 +1,53 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "oiseau/utils/aligned_matrix.hpp"
+
+using oiseau::utils::AlignedMatrix;
+
+namespace {
+
+/// A rank-2 expression with the `shape()` and `operator()` of an xtensor container.
+struct Expression {
+  std::array<std::size_t, 2> extents{3, 11};
+  const std::array<std::size_t, 2>& shape() const { return extents; }
+  double operator()(std::size_t i, std::size_t j) const { return 100.0 * i + j; }
+};
+
+}  // namespace
+
+TEST(test_aligned_matrix, padded_rows) {
+  const AlignedMatrix m = AlignedMatrix::from(Expression{});
+  EXPECT_EQ(m.rows(), 3);
+  EXPECT_EQ(m.cols(), 11);
+  EXPECT_EQ(m.stride(), 16);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(m.data()) % 64, 0);
+  for (std::size_t i = 0; i < m.rows(); ++i) {
+    for (std::size_t j = 0; j < m.stride(); ++j) {
+      EXPECT_EQ(m.data()[i * m.stride() + j], j < m.cols() ? 100.0 * i + j : 0.0);
+    }
+  }
+
+  const auto view = m.view();
+  EXPECT_EQ(view.extent(0), 3);
+  EXPECT_EQ(view.extent(1), 11);
+  EXPECT_EQ(view.stride(0), 16);
+  EXPECT_EQ((view[2, 10]), 210.0);
+}
+
+TEST(test_aligned_matrix, empty) {
+  const AlignedMatrix m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(AlignedMatrix::padded(0), 0);
+  EXPECT_EQ(AlignedMatrix::padded(8), 8);
+  EXPECT_EQ(AlignedMatrix::padded(9), 16);
+}
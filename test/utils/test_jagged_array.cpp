@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <ranges>
 #include <span>
 #include <sstream>
 #include <stdexcept>
@@ -47,6 +48,19 @@ TEST(jagged_array_constructor, num_rows_constructor) {
   }
 }
 
+TEST(jagged_array_constructor, flat_storage_constructor) {
+  JaggedArray<std::size_t> ja(std::vector<std::size_t>{0, 1, 2, 3, 4},
+                              std::vector<std::size_t>{0, 3, 3, 5});
+  EXPECT_EQ(ja.num_rows(), 3);
+  EXPECT_EQ(ja.num_cols(1), 0);
+  EXPECT_EQ(ja.at(2, 1), 4);
+  EXPECT_EQ(ja.data().size(), 5);
+  EXPECT_EQ(ja.row_offsets().back(), 5);
+  EXPECT_THROW(JaggedArray<int>(std::vector<int>{1, 2}, std::vector<std::size_t>{0, 1}),
+               std::invalid_argument);
+  static_assert(std::ranges::random_access_range<JaggedArray<int>>);
+}
+
 TEST(jagged_array_constructor, initializer_list_constructor_int) {
   JaggedArray<int> ja = {{1, 2, 3}, {4, 5}, {}, {6, 7, 8, 9}};
   EXPECT_FALSE(ja.is_empty());
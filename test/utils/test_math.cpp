@@ -7,7 +7,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
 #include "oiseau/utils/math.hpp"
@@ -35,3 +37,52 @@ TEST(test_utils, test_grad_jacobi_p) {
   auto output = oiseau::utils::grad_jacobi_p(n, alpha, beta, input);
   EXPECT_FLOATS_NEARLY_EQ(output, expected, 0.0001);
 }
+
+TEST(test_utils, test_jacobi_p_table) {
+  const unsigned n = 12;
+  std::vector<double> input = {-1.0, -0.55, 0.1, 0.3, 0.7, 0.9, 1.0};
+  for (const double alpha : {0.0, 1.0, 9.0}) {
+    const double beta = 2.0;
+    const auto table = oiseau::utils::jacobi_p_table(n, alpha, beta, input);
+    const auto grad_table = oiseau::utils::grad_jacobi_p_table(n, alpha, beta, input);
+    ASSERT_EQ(table.shape()[0], n + 1);
+    ASSERT_EQ(table.shape()[1], input.size());
+    for (unsigned k = 0; k <= n; ++k) {
+      const auto expected = oiseau::utils::jacobi_p(k, alpha, beta, input);
+      const auto grad_expected = oiseau::utils::grad_jacobi_p(k, alpha, beta, input);
+      for (std::size_t i = 0; i < input.size(); ++i) {
+        // Relative: the normalized polynomials grow like k^(alpha + 1/2) at x = 1.
+        EXPECT_NEAR(expected[i], table(k, i), 1e-11 * std::max(1.0, std::abs(expected[i])));
+        EXPECT_NEAR(grad_expected[i], grad_table(k, i),
+                    1e-11 * std::max(1.0, std::abs(grad_expected[i])));
+      }
+    }
+  }
+}
+
+TEST(test_utils, test_jacobi_vectorized) {
+  // Not a multiple of any vector width, so the last vector is partial.
+  std::vector<double> input(37);
+  for (std::size_t i = 0; i < input.size(); ++i) input[i] = -1.0 + 2.0 * i / 36.0;
+  const unsigned n = 9;
+  const double alpha = 1.0, beta = 3.0;
+  std::vector<double> output = input;
+  oiseau::utils::detail::transform_lanes(std::span<double>(output), [&](auto x) {
+    return oiseau::utils::jacobi(n, alpha, beta, x);
+  });
+  const std::vector<double> shifted(input.begin() + 3, input.end());
+  const auto normalized = oiseau::utils::jacobi_p(n, alpha, beta, input);
+  const auto shifted_normalized = oiseau::utils::jacobi_p(n, alpha, beta, shifted);
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    // Every point takes the same path, wherever it sits in the container.
+    if (i >= 3) {
+      EXPECT_EQ(normalized[i], shifted_normalized[i - 3]);
+    }
+    const double scalar = oiseau::utils::jacobi(n, alpha, beta, input[i]);
+#ifdef OISEAU_REPRODUCIBLE_MATH
+    EXPECT_EQ(output[i], scalar);
+#else
+    EXPECT_NEAR(output[i], scalar, 1e-12 * std::max(1.0, std::abs(scalar)));
+#endif
+  }
+}